@@ -0,0 +1,79 @@
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+using namespace std;
+
+struct Token {
+    string type;
+    string value;
+    int line;
+    int column;
+    
+    Token(string t, string v, int l, int c) : type(t), value(v), line(l), column(c) {}
+    
+    string toString() const {
+        return "Token(" + type + ", " + value + ", " + to_string(line) + ", " + to_string(column) + ")";
+    }
+};
+
+class Lexer {
+private:
+    string text;
+    size_t pos;
+    int line;
+    int column;
+    
+    
+public:
+    Lexer(const string& input) : text(input), pos(0), line(1), column(1) {}
+    
+    Token* nextToken();
+    vector<Token*> tokenize();
+};
+
+Token* Lexer::nextToken() {
+    // 跳过空白字符
+    while (pos < text.length() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r')) {
+        if (text[pos] == '\n') {
+            line++;
+            column = 1;
+        } else {
+            column++;
+        }
+        pos++;
+    }
+    
+    if (pos >= text.length()) {
+        return nullptr;
+    }
+    
+    // 尝试匹配每个规则（按文件中的顺序）
+    int longestLength = 0;
+    string matchedType;
+    
+    if (longestLength > 0) {
+        string value = text.substr(pos, longestLength);
+        Token* token = new Token(matchedType, value, line, column);
+        pos += longestLength;
+        column += longestLength;
+        return token;
+    }
+    
+    // 错误：无法识别的字符
+    throw runtime_error("Unexpected character '" + string(1, text[pos]) + "' at line " + to_string(line) + ", column " + to_string(column));
+}
+
+vector<Token*> Lexer::tokenize() {
+    vector<Token*> tokens;
+    while (pos < text.length()) {
+        Token* token = nextToken();
+        if (token) {
+            tokens.push_back(token);
+        } else {
+            break;
+        }
+    }
+    return tokens;
+}
+
@@ -1,44 +1,240 @@
 #include "CodeGenerator.h"
+#include <algorithm>
+#include <iomanip>
 #include <map>
+#include <queue>
 #include <set>
 #include <sstream>
 #include <stdexcept>
 
 using namespace std;
 
+// 是否有规则声明了字面量解码
+static bool hasAnyDecode(const vector<LexerRule> &rules) {
+    for (const auto &rule : rules) {
+        if (rule.decode != LiteralDecode::NONE) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// DFA 是否可能读入换行符（这样的记号可能跨行，需要更新行号）
+static bool matchesNewline(shared_ptr<DFA> dfa) {
+    for (const auto &state : dfa->states) {
+        if (state->transitions.count('\n')) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 规则是否为单个字节集合的重复：S*（只有一个接受状态，在 S 上回到自身），
+// 或 S+（起始状态在 S 上到达唯一的接受状态，接受状态在 S 上回到自身），
+// 没有其他转换。inSet 为集合 S。计数自动机的状态还带有计数上下界，不是
+// 单纯的字节集合重复
+static bool isByteSetRun(const StateLayout &layout, shared_ptr<DFA> dfa,
+                         vector<bool> &inSet) {
+    if (!dfa->counters.empty()) {
+        return false;
+    }
+    if (layout.states.size() == 2 && dfa->start->isAccepting) {
+        return false;
+    }
+    if (layout.states.size() > 2) {
+        return false;
+    }
+    shared_ptr<DFAState> run = layout.states.back() == dfa->start
+                                   ? layout.states[0]
+                                   : layout.states.back();
+    if (!run->isAccepting ||
+        run->transitions.size() != dfa->start->transitions.size()) {
+        return false;
+    }
+    inSet.assign(256, false);
+    for (auto &pair : dfa->start->transitions) {
+        auto loop = run->transitions.find(pair.first);
+        if (pair.second != run || loop == run->transitions.end() ||
+            loop->second != run) {
+            return false;
+        }
+        inSet[static_cast<unsigned char>(pair.first)] = true;
+    }
+    return true;
+}
+
 string CodeGenerator::generateLexerCode(const vector<LexerRule> &rules,
                                         const vector<shared_ptr<DFA>> &dfas) {
     if (rules.size() != dfas.size()) {
         throw runtime_error("规则数量和DFA数量不匹配");
     }
+    if (errorTokens) {
+        for (const auto &rule : rules) {
+            if (rule.tokenType == "ERROR") {
+                throw runtime_error("规则名 ERROR 与错误记号冲突");
+            }
+        }
+    }
 
-    ostringstream oss;
+    denseTableBytes = 0;
+    combTableBytes = 0;
+    memoizedRules.clear();
+    stride2Rules.clear();
+    scanRules.clear();
+
+    // 计算每条规则的状态布局，并检测需要线性时间最长匹配的规则
+    vector<StateLayout> layouts;
+    vector<bool> memoized;
+    vector<bool> multiline;
+    for (size_t i = 0; i < dfas.size(); i++) {
+        multiline.push_back(matchesNewline(dfas[i]));
+        layouts.push_back(layoutStates(rules[i], dfas[i]));
+        // 失败记忆以 (状态, 位置) 为键，不适用于还依赖计数器的计数自动机
+        memoized.push_back(dfas[i]->counters.empty() &&
+                           needsLinearMunch(dfas[i]));
+        if (memoized.back()) {
+            memoizedRules.push_back(rules[i].tokenType);
+        }
+    }
 
-    // 生成头文件和基本结构
-    oss << "#include <string>\n";
-    oss << "#include <vector>\n";
-    oss << "#include <stdexcept>\n";
+    // 头文件：Token 结构和 Lexer 类声明
+    ostringstream header;
+    header << "#pragma once\n";
+    header << "#include <string>\n";
+    header << "#include <vector>\n";
+    header << "#include <stdexcept>\n";
+    if (!memoizedRules.empty()) {
+        header << "#include <cstring>\n";
+    }
+    header << "\n";
+    header << "using namespace std;\n";
+    header << "\n";
+    header << generateTokenStruct(rules);
+    header << "\n";
+    // 与生成的语法分析器共用的接口，两边都用 TOKEN_SOURCE_DEFINED 防止重复定义
+    header << "#ifndef TOKEN_SOURCE_DEFINED\n";
+    header << "#define TOKEN_SOURCE_DEFINED\n";
+    header << "// 按需产生记号的来源：语法分析器每次拉取一个记号，"
+              "不必先得到整个记号序列\n";
+    header << "class TokenSource {\n";
+    header << "public:\n";
+    header << "    virtual ~TokenSource() {}\n";
+    header << "    // 把下一个记号写入 token（原有内容被覆盖），没有记号时返回 "
+              "false\n";
+    header << "    virtual bool next(Token& token) = 0;\n";
+    header << "};\n";
+    header << "#endif\n";
+    header << "\n";
+    if (!memoizedRules.empty()) {
+        header << generateFailureMemo();
+        header << "\n";
+    }
+    header << generateLexerClass(rules, layouts, memoized, multiline);
+    headerCode = header.str();
+
+    // 实现文件：转换表、匹配引擎和各方法的实现
+    ostringstream tables;
+    ostringstream methods;
+    for (size_t i = 0; i < dfas.size(); i++) {
+        methods << generateMatchMethod(static_cast<int>(i), rules[i], dfas[i],
+                                       layouts[i], memoized[i], tables);
+        methods << "\n";
+    }
+
+    ostringstream oss;
+    bool decoding = hasAnyDecode(rules);
+    bool advancing =
+        find(multiline.begin(), multiline.end(), true) != multiline.end();
+    oss << "#include \"" << headerName << "\"\n";
+    if (decoding) {
+        oss << "#include <cstdlib>\n";
+    }
+    if (decoding || advancing || !scanRules.empty()) {
+        oss << "#include <cstring>\n";
+    }
+    if (instrument) {
+        oss << "#include <fstream>\n";
+    }
     oss << "\n";
     oss << "using namespace std;\n";
     oss << "\n";
+    oss << generateMatchEngine();
+    if (!scanRules.empty()) {
+        oss << "// 64 位整数中是否有为 0 的字节\n";
+        oss << "static inline bool hasZeroByte(unsigned long long v) {\n";
+        oss << "    return ((v - 0x0101010101010101ULL) & ~v & "
+               "0x8080808080808080ULL) != 0;\n";
+        oss << "}\n";
+        oss << "\n";
+    }
+    if (!stride2Rules.empty()) {
+        oss << generateStride2Engine();
+    }
+    if (decoding) {
+        oss << generateDecoders(rules);
+    }
+    oss << tables.str();
 
-    // 生成Token结构
-    oss << generateTokenStruct();
+    // 生成scanToken方法及复用输入缓冲区和记号的方法
+    oss << generateNextToken(rules, dfas, multiline);
+    oss << generateReuseMethods(rules, memoized);
+
+    // 生成tokenize方法
+    oss << "vector<Token*> Lexer::tokenize() {\n";
+    oss << "    vector<Token*> tokens;\n";
+    oss << "    while (true) {\n";
+    oss << "        Token* token = nextToken();\n";
+    oss << "        if (token) {\n";
+    oss << "            tokens.push_back(token);\n";
+    oss << "        } else {\n";
+    oss << "            break;\n";
+    oss << "        }\n";
+    oss << "    }\n";
+    oss << "    return tokens;\n";
+    oss << "}\n";
     oss << "\n";
 
-    // 生成Lexer类
-    oss << generateLexerClass(rules, dfas);
+    if (instrument) {
+        oss << generateWriteProfile(rules, layouts);
+    }
+
+    // 为每个DFA生成匹配方法实现
+    oss << methods.str();
 
     return oss.str();
 }
 
-string CodeGenerator::generateTokenStruct() {
+bool CodeGenerator::hasDecode(const vector<LexerRule> &rules,
+                              LiteralDecode decode) {
+    for (const auto &rule : rules) {
+        if (rule.decode == decode) {
+            return true;
+        }
+    }
+    return false;
+}
+
+string CodeGenerator::generateTokenStruct(const vector<LexerRule> &rules) {
     ostringstream oss;
     oss << "struct Token {\n";
     oss << "    string type;\n";
     oss << "    string value;\n";
     oss << "    int line;\n";
     oss << "    int column;\n";
+    // 解码后的字面量值，只有声明了对应解码方式的规则会填写
+    if (hasDecode(rules, LiteralDecode::INT64)) {
+        oss << "    long long intValue = 0; // INT64 规则的值\n";
+    }
+    if (hasDecode(rules, LiteralDecode::DOUBLE)) {
+        oss << "    double floatValue = 0; // DOUBLE 规则的值\n";
+    }
+    if (hasDecode(rules, LiteralDecode::UNESCAPE)) {
+        oss << "    string stringValue; // UNESCAPE 规则处理转义后的内容\n";
+    }
+    if (hasDecode(rules, LiteralDecode::INTERN)) {
+        oss << "    unsigned symbol = 0; // INTERN 规则的符号编号，见 "
+               "Lexer::symbolName\n";
+    }
     oss << "    \n";
     oss << "    Token(string t, string v, int l, int c) : type(t), value(v), "
            "line(l), column(c) {}\n";
@@ -51,202 +247,1769 @@ string CodeGenerator::generateTokenStruct() {
     return oss.str();
 }
 
+void CodeGenerator::setProfile(const LexerProfile &p) {
+    profile = p;
+    totalStateVisits = 0;
+    totalTokens = 0;
+    for (const auto &rule : profile.stateVisits) {
+        for (const auto &state : rule.second) {
+            totalStateVisits += state.second;
+        }
+    }
+    for (const auto &token : profile.tokenCounts) {
+        totalTokens += token.second;
+    }
+}
+
+bool CodeGenerator::isHotState(long long visits) const {
+    return totalStateVisits > 0 && visits > 0 &&
+           visits * 100 >= totalStateVisits;
+}
+
+bool CodeGenerator::isHotToken(const string &tokenType) const {
+    auto it = profile.tokenCounts.find(tokenType);
+    return totalTokens > 0 && it != profile.tokenCounts.end() &&
+           it->second > 0 && it->second * 100 >= totalTokens;
+}
+
+string CodeGenerator::generateFailureMemo() {
+    ostringstream oss;
+    oss << "// 线性时间最长匹配的失败记忆：第 (位置 - base) * states + state "
+           "位表示\n";
+    oss << "// 从 (state, 位置) 出发不可能再到达接受状态。记号只向后推进，起点"
+           "之前\n";
+    oss << "// 的行不会再被查询：起点越过所有用过的行时清零这些行，越过一半时把"
+           "其余\n";
+    oss << "// 的行移到开头。内存与当前记号起点之后扫描过的范围成正比，不按输入"
+           "长度\n";
+    oss << "// 分配，并在记号之间重用\n";
+    oss << "struct FailureMemo {\n";
+    oss << "    vector<unsigned long long> bits;\n";
+    oss << "    size_t base;   // 第 0 行对应的输入位置\n";
+    oss << "    size_t rows;   // 用过的行数，之后的位全为 0\n";
+    oss << "    size_t states; // 每行的位数\n";
+    oss << "    size_t align;  // 行数是它的倍数时行边界落在字边界上\n";
+    oss << "    \n";
+    oss << "    explicit FailureMemo(size_t stateCount)\n";
+    oss << "        : base(0), rows(0), states(stateCount), align(64) {\n";
+    oss << "        while (align % 2 == 0 && align / 2 * states % 64 == 0) {\n";
+    oss << "            align /= 2;\n";
+    oss << "        }\n";
+    oss << "    }\n";
+    oss << "    \n";
+    oss << "    // 开始从 startPos 出发的一次匹配，丢弃 startPos 之前的行\n";
+    oss << "    void start(size_t startPos) {\n";
+    oss << "        if (startPos >= base + rows) {\n";
+    oss << "            clear();\n";
+    oss << "            base = startPos;\n";
+    oss << "        } else if ((startPos - base) * 2 > rows) {\n";
+    oss << "            // 按整字移动，base 停在 startPos 之前最近的对齐行\n";
+    oss << "            size_t drop = (startPos - base) / align * align;\n";
+    oss << "            size_t dead = drop * states / 64;\n";
+    oss << "            size_t used = words(rows);\n";
+    oss << "            memmove(bits.data(), bits.data() + dead,\n";
+    oss << "                    (used - dead) * sizeof(bits[0]));\n";
+    oss << "            memset(bits.data() + used - dead, 0, "
+           "dead * sizeof(bits[0]));\n";
+    oss << "            base += drop;\n";
+    oss << "            rows -= drop;\n";
+    oss << "        }\n";
+    oss << "    }\n";
+    oss << "    \n";
+    oss << "    bool failed(size_t position, int state) const {\n";
+    oss << "        size_t row = position - base;\n";
+    oss << "        size_t key = row * states + state;\n";
+    oss << "        return row < rows && "
+           "((bits[key >> 6] >> (key & 63)) & 1);\n";
+    oss << "    }\n";
+    oss << "    \n";
+    oss << "    // trail[j] 是位置 from + j 上的状态\n";
+    oss << "    void mark(size_t from, const vector<int>& trail) {\n";
+    oss << "        size_t end = from + trail.size() - base;\n";
+    oss << "        if (end > rows) {\n";
+    oss << "            if (bits.size() < words(end)) {\n";
+    oss << "                bits.resize(words(end), 0);\n";
+    oss << "            }\n";
+    oss << "            rows = end;\n";
+    oss << "        }\n";
+    oss << "        for (size_t j = 0; j < trail.size(); j++) {\n";
+    oss << "            size_t key = (from + j - base) * states + trail[j];\n";
+    oss << "            bits[key >> 6] |= 1ULL << (key & 63);\n";
+    oss << "        }\n";
+    oss << "    }\n";
+    oss << "    \n";
+    oss << "    // 清零用过的行，容量保留\n";
+    oss << "    void clear() {\n";
+    oss << "        if (rows > 0) {\n";
+    oss << "            memset(bits.data(), 0, "
+           "words(rows) * sizeof(bits[0]));\n";
+    oss << "        }\n";
+    oss << "        base = 0;\n";
+    oss << "        rows = 0;\n";
+    oss << "    }\n";
+    oss << "    \n";
+    oss << "    size_t words(size_t rowCount) const {\n";
+    oss << "        return (rowCount * states + 63) / 64;\n";
+    oss << "    }\n";
+    oss << "};\n";
+    return oss.str();
+}
+
 string CodeGenerator::generateLexerClass(const vector<LexerRule> &rules,
-                                         const vector<shared_ptr<DFA>> &dfas) {
+                                         const vector<StateLayout> &layouts,
+                                         const vector<bool> &memoized,
+                                         const vector<bool> &multiline) {
     ostringstream oss;
+    vector<string> modes = FileParser::collectModes(rules);
+    string modeInit = modes.size() > 1 ? ", mode(0)" : "";
 
-    oss << "class Lexer {\n";
+    oss << "class Lexer : public TokenSource {\n";
     oss << "private:\n";
     oss << "    string text;\n";
     oss << "    size_t pos;\n";
     oss << "    int line;\n";
     oss << "    int column;\n";
+    if (modes.size() > 1) {
+        oss << "    int mode;               // 当前模式（起始条件）\n";
+        oss << "    vector<int> modeStack;  // PUSH 时保存的模式\n";
+    }
+    oss << "    \n";
+
+    if (instrument) {
+        // 剖析计数器：状态按生成编号计数，输出时换算为规范编号
+        oss << "    // 剖析计数器\n";
+        oss << "    long long profileTokenCounts[" << rules.size()
+            << "] = {};\n";
+        for (size_t i = 0; i < rules.size(); i++) {
+            oss << "    long long profileStateVisits" << i << "["
+                << layouts[i].states.size() << "] = {};\n";
+        }
+        oss << "    \n";
+    }
+
+    if (!memoizedRules.empty()) {
+        // 回溯可能超线性的规则：记录已知失败的 (状态, 位置)，保证总扫描时间线性
+        oss << "    // 线性时间最长匹配：规则 N 已知失败的 (状态, 位置)\n";
+        for (size_t i = 0; i < rules.size(); i++) {
+            if (memoized[i]) {
+                oss << "    FailureMemo failed" << i << "{"
+                    << layouts[i].states.size() << "};\n";
+            }
+        }
+        oss << "    vector<int> munchTrail; // 最后一次接受之后经过的状态\n";
+        oss << "    \n";
+    }
+
+    bool interning = hasDecode(rules, LiteralDecode::INTERN);
+    if (interning) {
+        // 开放定址的符号表：槽中存符号编号 + 1，0 表示空槽
+        oss << "    // 符号表（INTERN 规则）：同名标识符只保存一份\n";
+        oss << "    vector<string> symbols;\n";
+        oss << "    vector<unsigned> symbolHashes;\n";
+        oss << "    vector<unsigned> symbolSlots;\n";
+        oss << "    unsigned intern(const char* p, size_t length);\n";
+        oss << "    \n";
+    }
+
+    oss << "    bool scanToken(Token& token);\n";
+    if (find(multiline.begin(), multiline.end(), true) != multiline.end()) {
+        oss << "    void advance(size_t length);\n";
+    }
+    if (errorTokens) {
+        oss << "    bool startsToken(size_t at);\n";
+    }
+    oss << "    void fillToken(Token& token, const char* type, "
+           "size_t length);\n";
     oss << "    \n";
 
     // 为每个DFA生成匹配方法声明
-    for (size_t i = 0; i < dfas.size(); i++) {
+    for (size_t i = 0; i < rules.size(); i++) {
         oss << "    int matchDFA" << i << "(size_t startPos);\n";
     }
     oss << "    \n";
 
     oss << "public:\n";
+    oss << "    Lexer() : pos(0), line(1), column(1)" << modeInit << " {}\n";
     oss << "    Lexer(const string& input) : text(input), pos(0), line(1), "
-           "column(1) {}\n";
+           "column(1)"
+        << modeInit << " {}\n";
+    oss << "    \n";
+    oss << "    // 从头分析新的输入，保留已分配的缓冲区和符号表\n";
+    oss << "    void reset(const char* data, size_t length);\n";
+    oss << "    void reset(const string& input) { reset(input.data(), "
+           "input.size()); }\n";
     oss << "    \n";
     oss << "    Token* nextToken();\n";
     oss << "    vector<Token*> tokenize();\n";
+    oss << "    \n";
+    oss << "    // 把剩余的记号写入 tokens（替换原有内容），返回记号数；\n";
+    oss << "    // 已有元素原地改写，反复使用同一个容器时不再分配内存\n";
+    oss << "    size_t tokenizeInto(vector<Token>& tokens);\n";
+    oss << "    \n";
+    oss << "    // TokenSource：供语法分析器按需拉取记号\n";
+    oss << "    bool next(Token& token) override "
+           "{ return scanToken(token); }\n";
+    if (modes.size() > 1) {
+        // 规则的 PUSH/POP 动作调用 pushMode/popMode，使用方也可以直接切换
+        oss << "    \n";
+        oss << "    // 模式（起始条件），只有属于当前模式的规则参与匹配\n";
+        oss << "    enum Mode {";
+        for (size_t m = 0; m < modes.size(); m++) {
+            oss << (m > 0 ? ", " : " ") << "MODE_" << modes[m] << " = " << m;
+        }
+        oss << " };\n";
+        oss << "    int getMode() const { return mode; }\n";
+        oss << "    void pushMode(int m) {\n";
+        oss << "        modeStack.push_back(mode);\n";
+        oss << "        mode = m;\n";
+        oss << "    }\n";
+        oss << "    void popMode() {\n";
+        oss << "        mode = modeStack.empty() ? MODE_INITIAL : "
+               "modeStack.back();\n";
+        oss << "        if (!modeStack.empty()) {\n";
+        oss << "            modeStack.pop_back();\n";
+        oss << "        }\n";
+        oss << "    }\n";
+    }
+    if (interning) {
+        oss << "    \n";
+        oss << "    // 符号编号对应的名字，编号在同一个 Lexer 内唯一\n";
+        oss << "    const string& symbolName(unsigned id) const { "
+               "return symbols[id]; }\n";
+        oss << "    size_t symbolCount() const { return symbols.size(); }\n";
+    }
+    if (instrument) {
+        oss << "    \n";
+        oss << "    // 将剖析数据写入文件，供生成器的 --profile 参数使用\n";
+        oss << "    bool writeProfile(const string& filename) const;\n";
+    }
+    oss << "};\n";
+
+    return oss.str();
+}
+
+// 规则匹配后的模式切换：先 POP 再 PUSH（两者都有时相当于替换栈顶）
+static string modeAction(const LexerRule &rule, const string &indent) {
+    string code;
+    if (rule.popMode) {
+        code += indent + "popMode();\n";
+    }
+    if (!rule.pushMode.empty()) {
+        code += indent + "pushMode(MODE_" + rule.pushMode + ");\n";
+    }
+    return code;
+}
+
+// 给代码的每个非空行加上缩进
+static string indentLines(const string &code, const string &indent) {
+    string result;
+    size_t begin = 0;
+    while (begin < code.size()) {
+        size_t end = code.find('\n', begin);
+        end = end == string::npos ? code.size() : end + 1;
+        if (code[begin] != '\n') {
+            result += indent;
+        }
+        result.append(code, begin, end - begin);
+        begin = end;
+    }
+    return result;
+}
+
+string CodeGenerator::generateNextToken(const vector<LexerRule> &rules,
+                                        const vector<shared_ptr<DFA>> &dfas,
+                                        const vector<bool> &multiline) {
+    ostringstream oss;
+    vector<string> modes = FileParser::collectModes(rules);
+    bool useModes = modes.size() > 1;
+    bool advancing =
+        find(multiline.begin(), multiline.end(), true) != multiline.end();
+    bool actions = false;
+    for (const auto &rule : rules) {
+        actions = actions || rule.popMode || !rule.pushMode.empty();
+    }
+
+    // 首字节候选规则：规则属于该模式，且DFA起始状态在该字节上有转换才可能
+    // 匹配。candidateRules 只统计 INITIAL 模式，用于快速路径
+    size_t words = (rules.size() + 63) / 64;
+    vector<vector<vector<unsigned long long>>> candidates(
+        modes.size(), vector<vector<unsigned long long>>(
+                          256, vector<unsigned long long>(words, 0)));
+    vector<vector<int>> candidateRules(256);
+    for (size_t i = 0; i < dfas.size(); i++) {
+        for (auto &pair : dfas[i]->start->transitions) {
+            int b = static_cast<unsigned char>(pair.first);
+            for (size_t m = 0; m < modes.size(); m++) {
+                if (rules[i].activeIn(modes[m])) {
+                    candidates[m][b][i / 64] |= 1ULL << (i % 64);
+                }
+            }
+            if (rules[i].activeIn("INITIAL")) {
+                candidateRules[b].push_back(static_cast<int>(i));
+            }
+        }
+    }
+
+    // 候选表放在文件作用域，scanToken 和错误恢复的 startsToken 共用
+    string indent = useModes ? "        " : "    ";
+    oss << "// 首字节候选规则：candidates" << (useModes ? "[mode]" : "")
+        << "[ch][i / 64] 的第 i % 64 位表示规则 i 可能以字节 ch 开头\n";
+    oss << "static const unsigned long long candidates"
+        << (useModes ? "[" + to_string(modes.size()) + "]" : "") << "[256]["
+        << words << "] = {\n";
+    for (size_t m = 0; m < modes.size(); m++) {
+        if (useModes) {
+            oss << "    // 模式 " << modes[m] << "\n";
+            oss << "    {\n";
+        }
+        for (int b = 0; b < 256; b++) {
+            oss << (b % 4 == 0 ? indent : " ") << "{";
+            for (size_t w = 0; w < words; w++) {
+                if (w > 0)
+                    oss << ", ";
+                oss << "0x" << hex << candidates[m][b][w] << dec << "ULL";
+            }
+            oss << "}," << (b % 4 == 3 ? "\n" : "");
+        }
+        if (useModes) {
+            oss << "    },\n";
+        }
+    }
     oss << "};\n";
     oss << "\n";
 
-    // 生成nextToken方法
-    oss << "Token* Lexer::nextToken() {\n";
-    oss << "    // 跳过空白字符\n";
-    oss << "    while (pos < text.length() && (text[pos] == ' ' || text[pos] "
-           "== "
-           "'\\t' || text[pos] == '\\n' || text[pos] == '\\r')) {\n";
-    oss << "        if (text[pos] == '\\n') {\n";
-    oss << "            line++;\n";
-    oss << "            column = 1;\n";
-    oss << "        } else {\n";
-    oss << "            column++;\n";
-    oss << "        }\n";
-    oss << "        pos++;\n";
-    oss << "    }\n";
-    oss << "    \n";
-    oss << "    if (pos >= text.length()) {\n";
-    oss << "        return nullptr;\n";
-    oss << "    }\n";
-    oss << "    \n";
-    oss << "    // 尝试匹配每个规则（按文件中的顺序）\n";
-    oss << "    int longestLength = 0;\n";
-    oss << "    string matchedType;\n";
-    oss << "    \n";
+    if (useModes && !errorTokens) {
+        oss << "// 模式名，用于错误信息\n";
+        oss << "static const char* const modeNames[" << modes.size()
+            << "] = {";
+        for (size_t m = 0; m < modes.size(); m++) {
+            oss << (m > 0 ? ", " : "") << "\"" << modes[m] << "\"";
+        }
+        oss << "};\n";
+        oss << "\n";
+    }
+
+    if (advancing) {
+        oss << "// 可能跨行的记号：按其中的换行符更新行号和列号\n";
+        oss << "void Lexer::advance(size_t length) {\n";
+        oss << "    const char* p = text.data() + pos;\n";
+        oss << "    const char* end = p + length;\n";
+        oss << "    const char* newline;\n";
+        oss << "    while ((newline = static_cast<const char*>(\n";
+        oss << "                memchr(p, '\\n', end - p))) != nullptr) {\n";
+        oss << "        line++;\n";
+        oss << "        column = 1;\n";
+        oss << "        p = newline + 1;\n";
+        oss << "    }\n";
+        oss << "    column += static_cast<int>(end - p);\n";
+        oss << "    pos += length;\n";
+        oss << "}\n";
+        oss << "\n";
+    }
+
+    // 记号写入调用者提供的 Token，nextToken 和 tokenizeInto 共用
+    oss << "bool Lexer::scanToken(Token& token) {\n";
+    ostringstream body;
+    ostringstream skip;
+    skip << "while (pos < text.length() && (text[pos] == ' ' || text[pos] == "
+            "'\\t' || text[pos] == '\\n' || text[pos] == '\\r')) {\n";
+    skip << "    if (text[pos] == '\\n') {\n";
+    skip << "        line++;\n";
+    skip << "        column = 1;\n";
+    skip << "    } else {\n";
+    skip << "        column++;\n";
+    skip << "    }\n";
+    skip << "    pos++;\n";
+    skip << "}\n";
+    if (useModes) {
+        // 其他模式（如注释、字符串）中的空白属于该模式的记号，由其规则处理
+        body << "    // 跳过空白字符（只在 INITIAL 模式中）\n";
+        body << "    if (mode == MODE_INITIAL) {\n";
+        body << indentLines(skip.str(), "        ");
+        body << "    }\n";
+    } else {
+        body << "    // 跳过空白字符\n";
+        body << indentLines(skip.str(), "    ");
+    }
+    body << "    \n";
+    body << "    if (pos >= text.length()) {\n";
+    if (useModes) {
+        // 输入在其他模式中结束说明结构没有闭合（如未闭合的块注释），
+        // 不能当作正常结束
+        body << "        if (mode != MODE_INITIAL) {\n";
+        if (errorTokens) {
+            body << "            // 输入在非 INITIAL 模式中结束：报告一个空的 "
+                    "ERROR 记号，回到 INITIAL\n";
+            body << "            fillToken(token, \"ERROR\", 0);\n";
+            body << "            mode = MODE_INITIAL;\n";
+            body << "            modeStack.clear();\n";
+            body << "            return true;\n";
+        } else {
+            body << "            // 错误：输入在非 INITIAL 模式中结束\n";
+            body << "            throw runtime_error(\"Unexpected end of input "
+                    "in mode \" + string(modeNames[mode]) + \" at line \" + "
+                    "to_string(line) + \", column \" + to_string(column));\n";
+        }
+        body << "        }\n";
+    }
+    body << "        return false;\n";
+    body << "    }\n";
+    body << "    \n";
+
+    body << "    unsigned char first = "
+            "static_cast<unsigned char>(text[pos]);\n";
+    body << "    const unsigned long long* cand = candidates"
+         << (useModes ? "[mode]" : "") << "[first];\n";
+    body << "    \n";
+
+    // 高频单字节token快速路径：该字节只可能开始这一条规则，且一步即到达无出边的接受状态
+    vector<pair<int, int>> fastPaths; // (字节, 规则)
+    for (int b = 0; b < 256; b++) {
+        if (candidateRules[b].size() != 1) {
+            continue;
+        }
+        int r = candidateRules[b][0];
+        if (rules[r].ignore || rules[r].decode != LiteralDecode::NONE ||
+            rules[r].popMode || !rules[r].pushMode.empty() ||
+            !isHotToken(rules[r].tokenType)) {
+            continue;
+        }
+        auto target = dfas[r]->start->transitions[static_cast<char>(b)];
+        if (target->isAccepting && target->transitions.empty()) {
+            fastPaths.push_back(make_pair(b, r));
+        }
+    }
+    if (!fastPaths.empty()) {
+        body << "    // 高频单字节token快速路径（来自剖析数据）\n";
+        if (useModes) {
+            // 快速路径只针对 INITIAL 模式，其他模式落到 default
+            body << "    switch (mode == MODE_INITIAL ? first : 256) {\n";
+        } else {
+            body << "    switch (first) {\n";
+        }
+        for (const auto &fp : fastPaths) {
+            body << "    case " << fp.first << ": { // "
+                 << rules[fp.second].tokenType << "\n";
+            if (instrument) {
+                body << "        profileTokenCounts[" << fp.second << "]++;\n";
+            }
+            body << "        fillToken(token, \"" << rules[fp.second].tokenType
+                 << "\", 1);\n";
+            body << "        pos++;\n";
+            body << "        column++;\n";
+            body << "        return true;\n";
+            body << "    }\n";
+        }
+        body << "    default:\n";
+        body << "        break;\n";
+        body << "    }\n";
+        body << "    \n";
+    }
+
+    body << "    // 尝试匹配每个候选规则（按文件中的顺序）\n";
+    body << "    int longestLength = 0;\n";
+    body << "    const char* matchedType = nullptr;\n";
+    bool decoding = hasAnyDecode(rules);
+    if (instrument || decoding || actions) {
+        body << "    int matchedRule = -1;\n";
+    }
+    body << "    \n";
 
     // 为每个规则生成匹配代码（按文件中的顺序）
     for (size_t i = 0; i < rules.size(); i++) {
 
-        oss << "    // 规则: " << rules[i].tokenType;
+        body << "    // 规则: " << rules[i].tokenType;
         if (rules[i].ignore) {
-            oss << " (IGNORE)";
+            body << " (IGNORE)";
         }
-        oss << "\n";
-        oss << "    int match" << i << " = matchDFA" << i << "(pos);\n";
+        body << "\n";
+        body << "    if (cand[" << i / 64 << "] & (1ULL << " << i % 64
+             << ")) {\n";
+        body << "        int match" << i << " = matchDFA" << i << "(pos);\n";
         if (rules[i].ignore) {
             // IGNORE规则：如果匹配成功，跳过这些字符，不返回token
-            oss << "    if (match" << i << " > 0) {\n";
-            oss << "        pos += match" << i << ";\n";
-            oss << "        column += match" << i << ";\n";
-            oss << "        return nextToken();  // 继续匹配下一个token\n";
-            oss << "    }\n";
+            body << "        if (match" << i << " > 0) {\n";
+            if (instrument) {
+                body << "            profileTokenCounts[" << i << "]++;\n";
+            }
+            if (multiline[i]) {
+                body << "            advance(match" << i << ");\n";
+            } else {
+                body << "            pos += match" << i << ";\n";
+                body << "            column += match" << i << ";\n";
+            }
+            body << modeAction(rules[i], "            ");
+            body << "            continue; // 继续匹配下一个token\n";
+            body << "        }\n";
         } else {
             // 普通规则：记录最长匹配
-            oss << "    if (match" << i << " > longestLength) {\n";
-            oss << "        longestLength = match" << i << ";\n";
-            oss << "        matchedType = \"" << rules[i].tokenType << "\";\n";
+            body << "        if (match" << i << " > longestLength) {\n";
+            body << "            longestLength = match" << i << ";\n";
+            body << "            matchedType = \"" << rules[i].tokenType
+                 << "\";\n";
+            if (instrument || decoding || actions) {
+                body << "            matchedRule = " << i << ";\n";
+            }
+            body << "        }\n";
+        }
+        body << "    }\n";
+        body << "    \n";
+    }
+
+    body << "    if (longestLength > 0) {\n";
+    if (instrument) {
+        body << "        profileTokenCounts[matchedRule]++;\n";
+    }
+    body << "        fillToken(token, matchedType, longestLength);\n";
+    if (decoding) {
+        // 解码匹配到的文本，此时这段输入刚扫描过，仍在缓存中
+        body << "        const char* literal = text.data() + pos;\n";
+        body << "        switch (matchedRule) {\n";
+        for (size_t i = 0; i < rules.size(); i++) {
+            if (rules[i].ignore || rules[i].decode == LiteralDecode::NONE) {
+                continue;
+            }
+            body << "        case " << i << ": // " << rules[i].tokenType
+                 << "\n";
+            if (rules[i].decode == LiteralDecode::INT64) {
+                body << "            token.intValue = decodeInt64(literal, "
+                        "longestLength);\n";
+            } else if (rules[i].decode == LiteralDecode::DOUBLE) {
+                body << "            token.floatValue = decodeDouble(literal, "
+                        "longestLength);\n";
+            } else if (rules[i].decode == LiteralDecode::UNESCAPE) {
+                body << "            token.stringValue = "
+                        "decodeUnescape(literal, longestLength);\n";
+            } else {
+                body << "            token.symbol = intern(literal, "
+                        "longestLength);\n";
+            }
+            body << "            break;\n";
+        }
+        body << "        default:\n";
+        body << "            break;\n";
+        body << "        }\n";
+    }
+    bool tokenAdvancing = false;
+    for (size_t i = 0; i < rules.size(); i++) {
+        tokenAdvancing = tokenAdvancing || (!rules[i].ignore && multiline[i]);
+    }
+    if (tokenAdvancing) {
+        body << "        advance(longestLength);\n";
+    } else {
+        body << "        pos += longestLength;\n";
+        body << "        column += longestLength;\n";
+    }
+    if (actions) {
+        body << "        switch (matchedRule) {\n";
+        for (size_t i = 0; i < rules.size(); i++) {
+            if (rules[i].ignore ||
+                (!rules[i].popMode && rules[i].pushMode.empty())) {
+                continue;
+            }
+            body << "        case " << i << ": // " << rules[i].tokenType
+                 << "\n";
+            body << modeAction(rules[i], "            ");
+            body << "            break;\n";
+        }
+        body << "        default:\n";
+        body << "            break;\n";
+        body << "        }\n";
+    }
+    body << "        return true;\n";
+    body << "    }\n";
+    body << "    \n";
+    if (errorTokens) {
+        // 不抛异常：从这里到下一个能开始记号的位置作为一个 ERROR 记号
+        body << "    // 错误恢复：无法识别的字节连同其后不能开始记号的字节"
+                "合并为一个 ERROR 记号\n";
+        body << "    size_t errorEnd = pos + 1;\n";
+        body << "    while (errorEnd < text.length() && "
+                "!startsToken(errorEnd)) {\n";
+        body << "        errorEnd++;\n";
+        body << "    }\n";
+        body << "    size_t errorLength = errorEnd - pos;\n";
+        body << "    fillToken(token, \"ERROR\", errorLength);\n";
+        body << "    pos = errorEnd;\n";
+        body << "    column += static_cast<int>(errorLength);\n";
+        body << "    return true;\n";
+    } else {
+        body << "    // 错误：无法识别的字符\n";
+        body << "    throw runtime_error(\"Unexpected character '\" + "
+                "string(1, text[pos]) + \"' at line \" + to_string(line) + "
+                "\", column \" + to_string(column));\n";
+    }
+    // IGNORE 规则匹配后回到循环开头继续匹配，而不是递归调用，
+    // 长注释被分成很多段时也不会耗尽栈
+    oss << "    while (true) {\n";
+    oss << indentLines(body.str(), "    ");
+    oss << "    }\n";
+    oss << "}\n";
+    oss << "\n";
+
+    if (errorTokens) {
+        // 空白（有多个模式时只在 INITIAL 中）和 IGNORE 规则也算能开始记号，
+        // 注释等不会并入 ERROR 记号
+        oss << "// 能否在 at 处开始一个记号（含空白和忽略的记号），"
+               "错误恢复时用于重新同步\n";
+        oss << "bool Lexer::startsToken(size_t at) {\n";
+        oss << "    char ch = text[at];\n";
+        oss << "    if (" << (useModes ? "mode == MODE_INITIAL && (" : "")
+            << "ch == ' ' || ch == '\\t' || ch == '\\n' || ch == '\\r'"
+            << (useModes ? ")" : "") << ") {\n";
+        oss << "        return true;\n";
+        oss << "    }\n";
+        oss << "    const unsigned long long* cand = candidates"
+            << (useModes ? "[mode]" : "")
+            << "[static_cast<unsigned char>(ch)];\n";
+        for (size_t i = 0; i < rules.size(); i++) {
+            oss << "    if ((cand[" << i / 64 << "] & (1ULL << " << i % 64
+                << ")) && matchDFA" << i << "(at) > 0) {\n";
+            oss << "        return true;\n";
             oss << "    }\n";
         }
-        oss << "    \n";
+        oss << "    return false;\n";
+        oss << "}\n";
+        oss << "\n";
     }
 
-    oss << "    if (longestLength > 0) {\n";
-    oss << "        string value = text.substr(pos, longestLength);\n";
-    oss << "        Token* token = new Token(matchedType, value, line, "
-           "column);\n";
-    oss << "        pos += longestLength;\n";
-    oss << "        column += longestLength;\n";
-    oss << "        return token;\n";
+    return oss.str();
+}
+
+string CodeGenerator::generateReuseMethods(const vector<LexerRule> &rules,
+                                           const vector<bool> &memoized) {
+    ostringstream oss;
+
+    // 填写记号：重用的 Token 中字符串的缓冲区保留，解码字段先清空
+    oss << "void Lexer::fillToken(Token& token, const char* type, "
+           "size_t length) {\n";
+    oss << "    token.type.assign(type);\n";
+    oss << "    token.value.assign(text, pos, length);\n";
+    oss << "    token.line = line;\n";
+    oss << "    token.column = column;\n";
+    if (hasDecode(rules, LiteralDecode::INT64)) {
+        oss << "    token.intValue = 0;\n";
+    }
+    if (hasDecode(rules, LiteralDecode::DOUBLE)) {
+        oss << "    token.floatValue = 0;\n";
+    }
+    if (hasDecode(rules, LiteralDecode::UNESCAPE)) {
+        oss << "    token.stringValue.clear();\n";
+    }
+    if (hasDecode(rules, LiteralDecode::INTERN)) {
+        oss << "    token.symbol = 0;\n";
+    }
+    oss << "}\n";
+    oss << "\n";
+
+    oss << "Token* Lexer::nextToken() {\n";
+    oss << "    Token token(\"\", \"\", 0, 0);\n";
+    oss << "    if (!scanToken(token)) {\n";
+    oss << "        return nullptr;\n";
     oss << "    }\n";
-    oss << "    \n";
-    oss << "    // 错误：无法识别的字符\n";
-    oss << "    throw runtime_error(\"Unexpected character '\" + string(1, "
-           "text[pos]) + \"' at line \" + to_string(line) + \", column \" + "
-           "to_string(column));\n";
+    oss << "    return new Token(std::move(token));\n";
     oss << "}\n";
     oss << "\n";
 
-    // 生成tokenize方法
-    oss << "vector<Token*> Lexer::tokenize() {\n";
-    oss << "    vector<Token*> tokens;\n";
-    oss << "    while (pos < text.length()) {\n";
-    oss << "        Token* token = nextToken();\n";
-    oss << "        if (token) {\n";
-    oss << "            tokens.push_back(token);\n";
-    oss << "        } else {\n";
+    // 换一个输入继续使用：text 的容量、失败记忆和符号表都保留
+    oss << "void Lexer::reset(const char* data, size_t length) {\n";
+    oss << "    text.assign(data, length);\n";
+    oss << "    pos = 0;\n";
+    oss << "    line = 1;\n";
+    oss << "    column = 1;\n";
+    if (FileParser::collectModes(rules).size() > 1) {
+        oss << "    mode = 0;\n";
+        oss << "    modeStack.clear();\n";
+    }
+    for (size_t i = 0; i < memoized.size(); i++) {
+        if (memoized[i]) {
+            oss << "    failed" << i << ".clear();\n";
+        }
+    }
+    oss << "}\n";
+    oss << "\n";
+
+    oss << "size_t Lexer::tokenizeInto(vector<Token>& tokens) {\n";
+    oss << "    size_t count = 0;\n";
+    oss << "    while (true) {\n";
+    oss << "        if (count == tokens.size()) {\n";
+    oss << "            tokens.push_back(Token(\"\", \"\", 0, 0));\n";
+    oss << "        }\n";
+    oss << "        if (!scanToken(tokens[count])) {\n";
     oss << "            break;\n";
     oss << "        }\n";
+    oss << "        count++;\n";
     oss << "    }\n";
-    oss << "    return tokens;\n";
+    oss << "    tokens.erase(tokens.begin() + count, tokens.end());\n";
+    oss << "    return count;\n";
     oss << "}\n";
     oss << "\n";
 
-    // 为每个DFA生成匹配方法实现
-    for (size_t i = 0; i < dfas.size(); i++) {
-        oss << generateMatchMethod(static_cast<int>(i), rules[i], dfas[i]);
-        oss << "\n";
-    }
-
     return oss.str();
 }
 
-string CodeGenerator::generateMatchMethod(int index, const LexerRule &rule,
-                                          shared_ptr<DFA> dfa) {
+string CodeGenerator::generateWriteProfile(const vector<LexerRule> &rules,
+                                           const vector<StateLayout> &layouts) {
     ostringstream oss;
 
-    // 构建状态ID映射
-    map<shared_ptr<DFAState>, int> stateIdMap;
-    int stateId = 0;
-    for (auto state : dfa->states) {
-        stateIdMap[state] = stateId++;
+    oss << "bool Lexer::writeProfile(const string& filename) const {\n";
+    oss << "    ofstream out(filename);\n";
+    oss << "    if (!out.is_open()) {\n";
+    oss << "        return false;\n";
+    oss << "    }\n";
+    oss << "    out << \"# lexer profile\\n\";\n";
+    for (size_t i = 0; i < rules.size(); i++) {
+        const StateLayout &layout = layouts[i];
+        oss << "    \n";
+        oss << "    // 规则: " << rules[i].tokenType << "\n";
+        oss << "    out << \"token " << rules[i].tokenType
+            << " \" << profileTokenCounts[" << i << "] << \"\\n\";\n";
+        oss << "    {\n";
+        oss << "        static const int canonical[" << layout.states.size()
+            << "] = {";
+        for (size_t s = 0; s < layout.canonicalIds.size(); s++) {
+            if (s > 0)
+                oss << ", ";
+            oss << layout.canonicalIds[s];
+        }
+        oss << "};\n";
+        oss << "        for (int s = 0; s < " << layout.states.size()
+            << "; s++) {\n";
+        oss << "            if (profileStateVisits" << i << "[s] > 0) {\n";
+        oss << "                out << \"state " << rules[i].tokenType
+            << " \" << canonical[s] << \" \" << profileStateVisits" << i
+            << "[s] << \"\\n\";\n";
+        oss << "            }\n";
+        oss << "        }\n";
+        oss << "    }\n";
     }
+    oss << "    return true;\n";
+    oss << "}\n";
+    oss << "\n";
+
+    return oss.str();
+}
 
-    int startStateId = stateIdMap[dfa->start];
+vector<shared_ptr<DFAState>> CodeGenerator::bfsOrder(shared_ptr<DFA> dfa) {
+    vector<shared_ptr<DFAState>> order;
+    set<shared_ptr<DFAState>> visited;
+    queue<shared_ptr<DFAState>> workQueue;
 
-    // 生成状态转换表
-    oss << "int Lexer::matchDFA" << index << "(size_t startPos) {\n";
-    oss << "    int state = " << startStateId << ";\n";
-    oss << "    size_t currentPos = startPos;\n";
-    oss << "    size_t lastAcceptingPos = string::npos;\n";
-    oss << "    \n";
+    workQueue.push(dfa->start);
+    visited.insert(dfa->start);
 
-    // 生成接受状态集合
-    set<int> acceptingStateIds;
+    while (!workQueue.empty()) {
+        auto state = workQueue.front();
+        workQueue.pop();
+        order.push_back(state);
+
+        // map<char, ...> 的顺序依赖 char 是否有符号，这里按无符号字节值遍历
+        for (int b = 0; b < 256; b++) {
+            char c = static_cast<char>(b);
+            if (!state->hasTransition(c)) {
+                continue;
+            }
+            auto target = state->transitions[c];
+            if (visited.find(target) == visited.end()) {
+                visited.insert(target);
+                workQueue.push(target);
+            }
+        }
+    }
+
+    return order;
+}
+
+bool CodeGenerator::needsLinearMunch(shared_ptr<DFA> dfa) {
+    // 活状态：能够到达接受状态的状态（反向传播直到不动点）
+    set<shared_ptr<DFAState>> live;
     for (auto state : dfa->states) {
         if (state->isAccepting) {
-            acceptingStateIds.insert(stateIdMap[state]);
+            live.insert(state);
+        }
+    }
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (auto state : dfa->states) {
+            if (live.find(state) != live.end()) {
+                continue;
+            }
+            for (auto &pair : state->transitions) {
+                if (live.find(pair.second) != live.end()) {
+                    live.insert(state);
+                    changed = true;
+                    break;
+                }
+            }
         }
     }
 
-    oss << "    // 接受状态集合\n";
-    oss << "    bool accepting[" << stateId << "] = {";
-    for (int i = 0; i < stateId; i++) {
-        if (i > 0)
-            oss << ", ";
-        oss << (acceptingStateIds.find(i) != acceptingStateIds.end() ? "true"
-                                                                     : "false");
+    // 在非接受的活状态子图上反复删除入度为0的状态，剩余状态即构成环
+    set<shared_ptr<DFAState>> nodes;
+    for (auto state : live) {
+        if (!state->isAccepting) {
+            nodes.insert(state);
+        }
+    }
+    changed = true;
+    while (changed && !nodes.empty()) {
+        changed = false;
+        map<shared_ptr<DFAState>, int> inDegree;
+        for (auto state : nodes) {
+            inDegree[state] += 0;
+            for (auto &pair : state->transitions) {
+                if (nodes.find(pair.second) != nodes.end()) {
+                    inDegree[pair.second]++;
+                }
+            }
+        }
+        for (auto &entry : inDegree) {
+            if (entry.second == 0) {
+                nodes.erase(entry.first);
+                changed = true;
+            }
+        }
+    }
+
+    return !nodes.empty();
+}
+
+StateLayout CodeGenerator::layoutStates(const LexerRule &rule,
+                                        shared_ptr<DFA> dfa) {
+    StateLayout layout;
+    vector<shared_ptr<DFAState>> order = bfsOrder(dfa);
+
+    // 剖析文件中的状态编号是BFS规范编号，按访问次数降序重排，
+    // 次数相同时保持BFS顺序，保证输出确定
+    map<int, long long> visits;
+    auto it = profile.stateVisits.find(rule.tokenType);
+    if (it != profile.stateVisits.end()) {
+        visits = it->second;
+    }
+
+    vector<pair<long long, int>> keyed;
+    for (int i = 0; i < static_cast<int>(order.size()); i++) {
+        auto v = visits.find(i);
+        long long count = v != visits.end() ? v->second : 0;
+        keyed.push_back(make_pair(-count, i));
+    }
+    sort(keyed.begin(), keyed.end());
+
+    for (const auto &k : keyed) {
+        int canonicalId = k.second;
+        layout.ids[order[canonicalId]] =
+            static_cast<int>(layout.states.size());
+        layout.states.push_back(order[canonicalId]);
+        layout.canonicalIds.push_back(canonicalId);
+        // 热状态排在最前面，直接编码为分支
+        if (isHotState(-k.first) &&
+            layout.directStates == static_cast<int>(layout.states.size()) - 1) {
+            layout.directStates++;
+        }
+    }
+
+    return layout;
+}
+
+CombTable CodeGenerator::buildCombTable(const vector<vector<int>> &rows) {
+    CombTable table;
+    int stateCount = static_cast<int>(rows.size());
+    table.base.assign(stateCount, 0);
+    table.def.assign(stateCount, -1);
+
+    // 与本行没有相同转换（字符和目标都相同）的行，差异不少于本行的转换数，
+    // 不会被选为默认行。所以只比较共有某条转换的行，每条转换只取最近的
+    // maxCandidates 行（flex 同样只保留有限个原型），状态很多时不再是
+    // 平方时间
+    const size_t maxCandidates = 64;
+    map<pair<int, int>, vector<int>> sharing; // (字符, 目标) -> 有该转换的行
+    vector<int> sizes(stateCount, 0);         // 每行的非空转换数
+    vector<int> same(stateCount, 0); // 候选行与本行相同的转换数
+    int firstFree = 0;               // 之前的位置都已占用
+
+    for (int s = 0; s < stateCount; s++) {
+        const vector<int> &row = rows[s];
+
+        // 本行需要存储的项（不使用默认行时）：所有非空转换
+        vector<pair<int, int>> entries;
+        for (int c = 0; c < 256; c++) {
+            if (row[c] != -1) {
+                entries.push_back(make_pair(c, row[c]));
+            }
+        }
+        sizes[s] = static_cast<int>(entries.size());
+
+        // 在已放置的行中选择差异最少的作为默认行（只选更早的行，保证默认链
+        // 无环；差异相同时取编号最小的）
+        vector<int> candidates;
+        for (const auto &e : entries) {
+            const vector<int> &owners = sharing[e];
+            size_t from = owners.size() > maxCandidates
+                              ? owners.size() - maxCandidates
+                              : 0;
+            for (size_t k = from; k < owners.size(); k++) {
+                if (same[owners[k]]++ == 0) {
+                    candidates.push_back(owners[k]);
+                }
+            }
+        }
+        sort(candidates.begin(), candidates.end());
+        size_t fewest = entries.size();
+        for (int d : candidates) {
+            // 差异 = 两行非空转换的并 - 相同的转换
+            int common = 0;
+            for (const auto &e : entries) {
+                common += rows[d][e.first] != -1;
+            }
+            size_t diff = entries.size() + sizes[d] - common - same[d];
+            if (diff < fewest) {
+                fewest = diff;
+                table.def[s] = d;
+            }
+            same[d] = 0;
+        }
+        for (const auto &e : entries) {
+            sharing[e].push_back(s);
+        }
+        if (table.def[s] != -1) {
+            // 沿默认链查得的结果恰好就是 rows[d][c]
+            const vector<int> &def = rows[table.def[s]];
+            entries.clear();
+            for (int c = 0; c < 256; c++) {
+                if (row[c] != def[c]) {
+                    entries.push_back(make_pair(c, row[c]));
+                }
+            }
+        }
+
+        // 找到第一个能容纳所有项的位置（base 可以为负，只要各项落在数组内）。
+        // firstFree 之前没有空位，首项从第一个空位开始尝试
+        int base = entries.empty() ? 0 : firstFree - entries.front().first;
+        while (true) {
+            bool fits = true;
+            for (const auto &e : entries) {
+                int k = base + e.first;
+                if (k < static_cast<int>(table.check.size()) &&
+                    table.check[k] != -1) {
+                    fits = false;
+                    break;
+                }
+            }
+            if (fits) {
+                break;
+            }
+            base++;
+        }
+
+        // 只扩展到实际用到的位置，查表时做一次边界检查
+        int needed = entries.empty() ? 0 : base + entries.back().first + 1;
+        if (static_cast<int>(table.check.size()) < needed) {
+            table.check.resize(needed, -1);
+            table.next.resize(needed, -1);
+        }
+        table.base[s] = base;
+        for (const auto &e : entries) {
+            table.check[base + e.first] = s;
+            table.next[base + e.first] = e.second;
+        }
+        while (firstFree < static_cast<int>(table.check.size()) &&
+               table.check[firstFree] != -1) {
+            firstFree++;
+        }
+    }
+
+    return table;
+}
+
+// 能容纳数组中所有值（以及 -1）的最窄整型，bytes 返回每个元素的字节数
+static string narrowIntType(const vector<int> &values, size_t *bytes) {
+    int minValue = -1, maxValue = -1;
+    for (int v : values) {
+        minValue = min(minValue, v);
+        maxValue = max(maxValue, v);
+    }
+    if (minValue >= -128 && maxValue <= 127) {
+        *bytes = 1;
+        return "signed char";
+    }
+    if (minValue >= -32768 && maxValue <= 32767) {
+        *bytes = 2;
+        return "short";
+    }
+    *bytes = 4;
+    return "int";
+}
+
+// 输出文件作用域的静态常量整型数组
+static void emitIntArray(ostringstream &oss, const string &type,
+                         const string &name, const vector<int> &values) {
+    oss << "static const " << type << " " << name << "[" << values.size()
+        << "] = {";
+    for (size_t i = 0; i < values.size(); i++) {
+        if (i > 0) {
+            oss << (i % 32 == 0 ? ",\n    " : ", ");
+        }
+        oss << values[i];
     }
     oss << "};\n";
-    oss << "    \n";
+}
 
-    // 生成转换表
-    oss << "    // 状态转换表: transitions[state][char] = nextState\n";
-    oss << "    int transitions[" << stateId << "][256];\n";
-    oss << "    // 初始化为-1（无转换）\n";
-    oss << "    for (int i = 0; i < " << stateId << "; i++) {\n";
-    oss << "        for (int j = 0; j < 256; j++) {\n";
-    oss << "            transitions[i][j] = -1;\n";
+// 直接编码一个状态的转换：按目标状态分组为字节区间判断
+static void emitDirectTransitions(ostringstream &oss, const vector<int> &row,
+                                  const string &indent) {
+    // 目标状态 -> 字节区间列表
+    map<int, vector<pair<int, int>>> ranges;
+    for (int b = 0; b < 256; b++) {
+        if (row[b] == -1) {
+            continue;
+        }
+        vector<pair<int, int>> &list = ranges[row[b]];
+        if (!list.empty() && list.back().second == b - 1) {
+            list.back().second = b;
+        } else {
+            list.push_back(make_pair(b, b));
+        }
+    }
+
+    bool firstBranch = true;
+    for (const auto &target : ranges) {
+        oss << indent << (firstBranch ? "if (" : "} else if (");
+        firstBranch = false;
+        for (size_t i = 0; i < target.second.size(); i++) {
+            const auto &r = target.second[i];
+            if (i > 0)
+                oss << " || ";
+            if (r.first == r.second) {
+                oss << "ch == " << r.first;
+            } else {
+                oss << "(ch >= " << r.first << " && ch <= " << r.second << ")";
+            }
+        }
+        oss << ") {\n";
+        oss << indent << "    nextState = " << target.first << ";\n";
+    }
+    if (firstBranch) {
+        oss << indent << "nextState = -1;\n";
+    } else {
+        oss << indent << "} else {\n";
+        oss << indent << "    nextState = -1;\n";
+        oss << indent << "}\n";
+    }
+}
+
+string CodeGenerator::generateMatchEngine() {
+    ostringstream oss;
+    if (tableFormat == TableFormat::COMB) {
+        oss << "// 通用匹配引擎（行位移压缩表）：check[base[s]+c] == s 时取 "
+               "next，否则沿默认状态继续查找\n";
+        oss << "template <typename B, typename T>\n";
+        oss << "static int runCombDFA(const B* base, const T* def, const T* "
+               "next, const T* check, unsigned size,\n";
+        oss << "                      const bool* accepting, int state, const "
+               "string& text, size_t startPos) {\n";
+    } else {
+        oss << "// 通用匹配引擎（稠密表）：transitions[state][char] = "
+               "nextState（-1表示无转换）\n";
+        oss << "template <typename T>\n";
+        oss << "static int runDenseDFA(const T (*transitions)[256], const "
+               "bool* accepting, int state,\n";
+        oss << "                       const string& text, size_t startPos) "
+               "{\n";
+    }
+    oss << "    size_t currentPos = startPos;\n";
+    oss << "    size_t lastAcceptingPos = string::npos;\n";
+    oss << "    while (currentPos < text.length()) {\n";
+    oss << "        unsigned char ch = static_cast<unsigned "
+           "char>(text[currentPos]);\n";
+    if (tableFormat == TableFormat::COMB) {
+        oss << "        int s = state;\n";
+        oss << "        while (s != -1 && (static_cast<unsigned>(base[s] + ch) "
+               ">= size || check[base[s] + ch] != s)) {\n";
+        oss << "            s = def[s];\n";
+        oss << "        }\n";
+        oss << "        int nextState = s == -1 ? -1 : next[base[s] + ch];\n";
+    } else {
+        oss << "        int nextState = transitions[state][ch];\n";
+    }
+    oss << "        if (nextState == -1) {\n";
+    oss << "            break;\n";
+    oss << "        }\n";
+    oss << "        state = nextState;\n";
+    oss << "        currentPos++;\n";
+    oss << "        if (accepting[state]) {\n";
+    oss << "            lastAcceptingPos = currentPos;\n";
     oss << "        }\n";
     oss << "    }\n";
-    oss << "    \n";
+    oss << "    if (lastAcceptingPos != string::npos) {\n";
+    oss << "        return static_cast<int>(lastAcceptingPos - startPos);\n";
+    oss << "    }\n";
+    oss << "    return 0;\n";
+    oss << "}\n";
+    oss << "\n";
+    return oss.str();
+}
 
-    // 填充转换表
-    for (auto state : dfa->states) {
-        int fromId = stateIdMap[state];
-        for (auto &pair : state->transitions) {
-            char c = pair.first;
-            auto targetState = pair.second;
-            int toId = stateIdMap[targetState];
-            oss << "    transitions[" << fromId << "]["
-                << static_cast<int>(static_cast<unsigned char>(c))
-                << "] = " << toId << ";\n";
+string CodeGenerator::generateStride2Engine() {
+    ostringstream oss;
+    oss << "// 双字节步进匹配引擎：每次按相邻两个字节的字节类查一次 pairs 表，"
+           "依赖链上的查表次数减半。\n";
+    oss << "// 表项第0位表示读完第一个字节后可接受，第1位表示只能前进一个字节，"
+           "第2位表示读完两个字节后可接受，\n";
+    oss << "// 其余位为下一状态的行在 pairs 中的起始位置；-1表示第一个字节即无"
+           "转换。第二个字节类为 classCount 表示输入已结束\n";
+    oss << "template <typename C, typename T>\n";
+    oss << "static int runStride2DFA(const C* classes, int classCount, "
+           "const T* pairs, int row,\n";
+    oss << "                         const string& text, size_t startPos) {\n";
+    oss << "    size_t currentPos = startPos;\n";
+    oss << "    size_t lastAcceptingPos = string::npos;\n";
+    oss << "    size_t length = text.length();\n";
+    oss << "    while (currentPos < length) {\n";
+    oss << "        int c1 = classes[static_cast<unsigned "
+           "char>(text[currentPos])];\n";
+    oss << "        int c2 = currentPos + 1 < length ? "
+           "classes[static_cast<unsigned char>(text[currentPos + 1])] : "
+           "classCount;\n";
+    oss << "        int entry = pairs[row + c1 * (classCount + 1) + c2];\n";
+    oss << "        if (entry == -1) {\n";
+    oss << "            break;\n";
+    oss << "        }\n";
+    oss << "        if (entry & 1) {\n";
+    oss << "            lastAcceptingPos = currentPos + 1;\n";
+    oss << "        }\n";
+    oss << "        if (entry & 2) {\n";
+    oss << "            break;\n";
+    oss << "        }\n";
+    oss << "        currentPos += 2;\n";
+    oss << "        if (entry & 4) {\n";
+    oss << "            lastAcceptingPos = currentPos;\n";
+    oss << "        }\n";
+    oss << "        row = entry >> 3;\n";
+    oss << "    }\n";
+    oss << "    if (lastAcceptingPos != string::npos) {\n";
+    oss << "        return static_cast<int>(lastAcceptingPos - startPos);\n";
+    oss << "    }\n";
+    oss << "    return 0;\n";
+    oss << "}\n";
+    oss << "\n";
+    return oss.str();
+}
+
+bool CodeGenerator::buildStride2Table(const vector<vector<int>> &rows,
+                                      const vector<bool> &accepting,
+                                      vector<int> &classes, int &classCount,
+                                      vector<int> &pairs) {
+    // 字节类：在所有状态下转换都相同的字节归为一类，按首次出现的字节编号
+    map<vector<int>, int> columnClass;
+    vector<int> representatives;
+    classes.assign(256, 0);
+    for (int b = 0; b < 256; b++) {
+        vector<int> column;
+        for (const auto &row : rows) {
+            column.push_back(row[b]);
+        }
+        auto it = columnClass.find(column);
+        if (it == columnClass.end()) {
+            int id = static_cast<int>(representatives.size());
+            it = columnClass.insert(make_pair(column, id)).first;
+            representatives.push_back(b);
         }
+        classes[b] = it->second;
     }
+    classCount = static_cast<int>(representatives.size());
 
+    // 每个状态一行，行内按 (第一个字节类, 第二个字节类或输入结束) 排列
+    size_t rowWidth = static_cast<size_t>(classCount) * (classCount + 1);
+    size_t entries = rows.size() * rowWidth;
+    size_t maxEntry = (entries - rowWidth) * 8 + 7;
+    size_t entryBytes = maxEntry <= 127 ? 1 : maxEntry <= 32767 ? 2 : 4;
+    if (entries * entryBytes + 256 > stride2Budget) {
+        return false;
+    }
+
+    pairs.assign(entries, -1);
+    for (size_t s = 0; s < rows.size(); s++) {
+        for (int c1 = 0; c1 < classCount; c1++) {
+            int first = rows[s][representatives[c1]];
+            if (first == -1) {
+                continue;
+            }
+            int bits = accepting[first] ? 1 : 0;
+            for (int c2 = 0; c2 <= classCount; c2++) {
+                int second =
+                    c2 < classCount ? rows[first][representatives[c2]] : -1;
+                int entry = bits | 2; // 只能前进一个字节
+                if (second != -1) {
+                    entry = static_cast<int>(second * rowWidth) * 8 |
+                            (accepting[second] ? 4 : 0) | bits;
+                }
+                pairs[s * rowWidth + c1 * (classCount + 1) + c2] = entry;
+            }
+        }
+    }
+    return true;
+}
+
+string CodeGenerator::generateDecoders(const vector<LexerRule> &rules) {
+    ostringstream oss;
+    bool digits = hasDecode(rules, LiteralDecode::INT64) ||
+                  hasDecode(rules, LiteralDecode::DOUBLE);
+    oss << "// 字面量解码：在刚匹配过（仍在缓存中）的记号文本上转换"
+           "，数字8位一组用SWAR处理\n";
+    if (digits) {
+        oss << "static inline unsigned long long loadEightBytes(const char* "
+               "p) {\n";
+        oss << "    unsigned long long v;\n";
+        oss << "    memcpy(&v, p, 8);\n";
+        oss << "#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == "
+               "__ORDER_BIG_ENDIAN__\n";
+        oss << "    v = __builtin_bswap64(v);\n";
+        oss << "#endif\n";
+        oss << "    return v;\n";
+        oss << "}\n";
+        oss << "\n";
+        oss << "// 8个字节是否都是 '0'..'9'\n";
+        oss << "static inline bool isEightDigits(unsigned long long v) {\n";
+        oss << "    unsigned long long high = v & 0xF0F0F0F0F0F0F0F0ULL;\n";
+        oss << "    unsigned long long carry =\n";
+        oss << "        (v + 0x0606060606060606ULL) & "
+               "0xF0F0F0F0F0F0F0F0ULL;\n";
+        oss << "    return (high | carry >> 4) == 0x3333333333333333ULL;\n";
+        oss << "}\n";
+        oss << "\n";
+        oss << "// 8位数字的值：相邻的1位、2位、4位数字两两合并，共3次乘法\n";
+        oss << "static inline unsigned long long parseEightDigits(unsigned "
+               "long long v) {\n";
+        oss << "    v = ((v & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;\n";
+        oss << "    v = ((v & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;\n";
+        oss << "    return ((v & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) "
+               ">> 32;\n";
+        oss << "}\n";
+        oss << "\n";
+        oss << "// 读入一串十进制数字：跳过前导零，有效数字最多19位累加到 "
+               "mantissa\n";
+        oss << "// （digits 为已累加的位数），其余计入 "
+               "dropped；返回数字之后的位置\n";
+        oss << "static const char* readDigits(const char* p, const char* "
+               "end,\n";
+        oss << "                              unsigned long long& mantissa, "
+               "int& digits,\n";
+        oss << "                              int& dropped) {\n";
+        oss << "    if (digits == 0) {\n";
+        oss << "        while (p < end && *p == '0') {\n";
+        oss << "            p++;\n";
+        oss << "        }\n";
+        oss << "    }\n";
+        oss << "    while (end - p >= 8 && digits <= 11) {\n";
+        oss << "        unsigned long long v = loadEightBytes(p);\n";
+        oss << "        if (!isEightDigits(v)) {\n";
+        oss << "            break;\n";
+        oss << "        }\n";
+        oss << "        mantissa = mantissa * 100000000ULL + "
+               "parseEightDigits(v);\n";
+        oss << "        digits += 8;\n";
+        oss << "        p += 8;\n";
+        oss << "    }\n";
+        oss << "    while (p < end && *p >= '0' && *p <= '9') {\n";
+        oss << "        if (digits < 19) {\n";
+        oss << "            mantissa = mantissa * 10 + (*p - '0');\n";
+        oss << "            digits++;\n";
+        oss << "        } else {\n";
+        oss << "            dropped++;\n";
+        oss << "        }\n";
+        oss << "        p++;\n";
+        oss << "    }\n";
+        oss << "    return p;\n";
+        oss << "}\n";
+        oss << "\n";
+    }
+    if (hasDecode(rules, LiteralDecode::INT64)) {
+        oss << "// INT64：可选的正负号后跟十进制数字，超出范围时取最大或最小值"
+               "\n";
+        oss << "static long long decodeInt64(const char* p, size_t length) "
+               "{\n";
+        oss << "    const char* end = p + length;\n";
+        oss << "    bool negative = p < end && *p == '-';\n";
+        oss << "    if (p < end && (*p == '-' || *p == '+')) {\n";
+        oss << "        p++;\n";
+        oss << "    }\n";
+        oss << "    unsigned long long mantissa = 0;\n";
+        oss << "    int digits = 0;\n";
+        oss << "    int dropped = 0;\n";
+        oss << "    readDigits(p, end, mantissa, digits, dropped);\n";
+        oss << "    unsigned long long limit = 9223372036854775807ULL + "
+               "(negative ? 1 : 0);\n";
+        oss << "    if (dropped > 0 || mantissa > limit) {\n";
+        oss << "        mantissa = limit;\n";
+        oss << "    }\n";
+        oss << "    if (!negative || mantissa == 0) {\n";
+        oss << "        return static_cast<long long>(mantissa);\n";
+        oss << "    }\n";
+        oss << "    return -static_cast<long long>(mantissa - 1) - 1;\n";
+        oss << "}\n";
+        oss << "\n";
+    }
+    if (hasDecode(rules, LiteralDecode::DOUBLE)) {
+        oss << "// DOUBLE：[+-]数字[.数字][(e|E)[+-]数字]\n";
+        oss << "static double decodeDouble(const char* p, size_t length) {\n";
+        oss << "    static const double powers[] = {1e0,  1e1,  1e2,  1e3,  "
+               "1e4,  1e5,\n";
+        oss << "                                    1e6,  1e7,  1e8,  1e9,  "
+               "1e10, 1e11,\n";
+        oss << "                                    1e12, 1e13, 1e14, 1e15, "
+               "1e16, 1e17,\n";
+        oss << "                                    1e18, 1e19, 1e20, 1e21, "
+               "1e22};\n";
+        oss << "    const char* begin = p;\n";
+        oss << "    const char* end = p + length;\n";
+        oss << "    bool negative = p < end && *p == '-';\n";
+        oss << "    if (p < end && (*p == '-' || *p == '+')) {\n";
+        oss << "        p++;\n";
+        oss << "    }\n";
+        oss << "    unsigned long long mantissa = 0;\n";
+        oss << "    int digits = 0;\n";
+        oss << "    int dropped = 0;\n";
+        oss << "    p = readDigits(p, end, mantissa, digits, dropped);\n";
+        oss << "    long exponent = dropped; // 整数部分舍去的数字\n";
+        oss << "    if (p < end && *p == '.') {\n";
+        oss << "        const char* fraction = ++p;\n";
+        oss << "        int droppedBefore = dropped;\n";
+        oss << "        p = readDigits(p, end, mantissa, digits, dropped);\n";
+        oss << "        exponent -= static_cast<long>(p - fraction) - "
+               "(dropped - droppedBefore);\n";
+        oss << "    }\n";
+        oss << "    if (p < end && (*p == 'e' || *p == 'E')) {\n";
+        oss << "        p++;\n";
+        oss << "        bool negativeExponent = p < end && *p == '-';\n";
+        oss << "        if (p < end && (*p == '-' || *p == '+')) {\n";
+        oss << "            p++;\n";
+        oss << "        }\n";
+        oss << "        long value = 0;\n";
+        oss << "        while (p < end && *p >= '0' && *p <= '9') {\n";
+        oss << "            if (value < 100000) {\n";
+        oss << "                value = value * 10 + (*p - '0');\n";
+        oss << "            }\n";
+        oss << "            p++;\n";
+        oss << "        }\n";
+        oss << "        exponent += negativeExponent ? -value : value;\n";
+        oss << "    }\n";
+        oss << "    // 快速路径：尾数不超过 2^53、10的幂次不超过22时两者都能精"
+               "确表示，\n";
+        oss << "    // 一次乘除即为正确舍入的结果；其余情况回退到 strtod\n";
+        oss << "    if (dropped == 0 && mantissa <= (1ULL << 53) && exponent "
+               ">= -22 &&\n";
+        oss << "        exponent <= 22) {\n";
+        oss << "        double value = static_cast<double>(mantissa);\n";
+        oss << "        value = exponent < 0 ? value / powers[-exponent]\n";
+        oss << "                             : value * powers[exponent];\n";
+        oss << "        return negative ? -value : value;\n";
+        oss << "    }\n";
+        oss << "    return strtod(string(begin, end).c_str(), nullptr);\n";
+        oss << "}\n";
+        oss << "\n";
+    }
+    if (hasDecode(rules, LiteralDecode::UNESCAPE)) {
+        oss << "// UNESCAPE：去掉首尾成对的引号，处理 \\n \\t \\r \\0，其他 "
+               "\\x 取 x 本身\n";
+        oss << "static string decodeUnescape(const char* p, size_t length) "
+               "{\n";
+        oss << "    if (length >= 2 && (p[0] == '\"' || p[0] == '\\'') &&\n";
+        oss << "        p[length - 1] == p[0]) {\n";
+        oss << "        p++;\n";
+        oss << "        length -= 2;\n";
+        oss << "    }\n";
+        oss << "    const char* end = p + length;\n";
+        oss << "    string result;\n";
+        oss << "    result.reserve(length);\n";
+        oss << "    while (p < end) {\n";
+        oss << "        const char* slash =\n";
+        oss << "            static_cast<const char*>(memchr(p, '\\\\', end - "
+               "p));\n";
+        oss << "        if (!slash || slash + 1 == end) {\n";
+        oss << "            result.append(p, end);\n";
+        oss << "            break;\n";
+        oss << "        }\n";
+        oss << "        result.append(p, slash);\n";
+        oss << "        char ch = slash[1];\n";
+        oss << "        result += ch == 'n'   ? '\\n'\n";
+        oss << "                  : ch == 't' ? '\\t'\n";
+        oss << "                  : ch == 'r' ? '\\r'\n";
+        oss << "                  : ch == '0' ? '\\0'\n";
+        oss << "                              : ch;\n";
+        oss << "        p = slash + 2;\n";
+        oss << "    }\n";
+        oss << "    return result;\n";
+        oss << "}\n";
+        oss << "\n";
+    }
+    if (hasDecode(rules, LiteralDecode::INTERN)) {
+        oss << "// 符号的哈希值：每次取8个字节与状态异或后乘以奇数常量\n";
+        oss << "static inline unsigned hashSymbol(const char* p, size_t "
+               "length) {\n";
+        oss << "    unsigned long long h = 0x9E3779B97F4A7C15ULL ^ length;\n";
+        oss << "    for (; length >= 8; p += 8, length -= 8) {\n";
+        oss << "        unsigned long long w;\n";
+        oss << "        memcpy(&w, p, 8);\n";
+        oss << "        h = (h ^ w) * 0xFF51AFD7ED558CCDULL;\n";
+        oss << "        h ^= h >> 29;\n";
+        oss << "    }\n";
+        oss << "    if (length > 0) {\n";
+        oss << "        unsigned long long w = 0;\n";
+        oss << "        memcpy(&w, p, length);\n";
+        oss << "        h = (h ^ w) * 0xFF51AFD7ED558CCDULL;\n";
+        oss << "    }\n";
+        oss << "    h ^= h >> 32;\n";
+        oss << "    return static_cast<unsigned>(h);\n";
+        oss << "}\n";
+        oss << "\n";
+        oss << "unsigned Lexer::intern(const char* p, size_t length) {\n";
+        oss << "    unsigned hash = hashSymbol(p, length);\n";
+        oss << "    // 装载因子不超过 1/2，超过时容量加倍并按保存的哈希值重新"
+               "放置\n";
+        oss << "    if (symbols.size() * 2 >= symbolSlots.size()) {\n";
+        oss << "        size_t capacity = symbolSlots.empty() ? 256 : "
+               "symbolSlots.size() * 2;\n";
+        oss << "        symbolSlots.assign(capacity, 0);\n";
+        oss << "        for (size_t id = 0; id < symbols.size(); id++) {\n";
+        oss << "            size_t i = symbolHashes[id] & (capacity - 1);\n";
+        oss << "            while (symbolSlots[i] != 0) {\n";
+        oss << "                i = (i + 1) & (capacity - 1);\n";
+        oss << "            }\n";
+        oss << "            symbolSlots[i] = static_cast<unsigned>(id + 1);\n";
+        oss << "        }\n";
+        oss << "    }\n";
+        oss << "    size_t mask = symbolSlots.size() - 1;\n";
+        oss << "    for (size_t i = hash & mask;; i = (i + 1) & mask) {\n";
+        oss << "        unsigned slot = symbolSlots[i];\n";
+        oss << "        if (slot == 0) {\n";
+        oss << "            symbols.push_back(string(p, length));\n";
+        oss << "            symbolHashes.push_back(hash);\n";
+        oss << "            symbolSlots[i] = static_cast<unsigned>("
+               "symbols.size());\n";
+        oss << "            return static_cast<unsigned>(symbols.size() - "
+               "1);\n";
+        oss << "        }\n";
+        oss << "        const string& name = symbols[slot - 1];\n";
+        oss << "        if (symbolHashes[slot - 1] == hash && name.size() == "
+               "length &&\n";
+        oss << "            memcmp(name.data(), p, length) == 0) {\n";
+        oss << "            return slot - 1;\n";
+        oss << "        }\n";
+        oss << "    }\n";
+        oss << "}\n";
+        oss << "\n";
+    }
+
+    return oss.str();
+}
+
+string CodeGenerator::generateMatchMethod(int index, const LexerRule &rule,
+                                          shared_ptr<DFA> dfa,
+                                          const StateLayout &layout,
+                                          bool memoize, ostringstream &tables) {
+    ostringstream oss;
+
+    // 单个字节集合的重复（如块注释的正文 [^*]+）：直接扫描到第一个不在
+    // 集合中的字节。集合外只有一个字节时用 memchr，不超过 4 个时 8 字节一组
+    // 检查，组内没有这些字节就整组跳过
+    vector<bool> inSet;
+    if (!instrument && isByteSetRun(layout, dfa, inSet)) {
+        scanRules.push_back(rule.tokenType);
+        vector<int> stops;
+        for (int b = 0; b < 256; b++) {
+            if (!inSet[b]) {
+                stops.push_back(b);
+            }
+        }
+        oss << "int Lexer::matchDFA" << index << "(size_t startPos) {\n";
+        oss << "    const char* begin = text.data() + startPos;\n";
+        oss << "    const char* end = text.data() + text.length();\n";
+        if (stops.size() == 1) {
+            oss << "    const char* stop = static_cast<const char*>(\n";
+            oss << "        memchr(begin, " << stops[0] << ", end - begin));\n";
+            oss << "    return static_cast<int>((stop ? stop : end) - "
+                   "begin);\n";
+        } else {
+            oss << "    static const bool inSet[256] = {\n";
+            for (int b = 0; b < 256; b++) {
+                oss << (b % 32 == 0 ? "        " : "") << (inSet[b] ? 1 : 0)
+                    << (b == 255 ? "\n" : (b % 32 == 31 ? ",\n" : ", "));
+            }
+            oss << "    };\n";
+            oss << "    const char* p = begin;\n";
+            if (stops.size() <= 4) {
+                oss << "    for (; end - p >= 8; p += 8) {\n";
+                oss << "        unsigned long long w;\n";
+                oss << "        memcpy(&w, p, 8);\n";
+                oss << "        if (";
+                for (size_t k = 0; k < stops.size(); k++) {
+                    oss << (k > 0 ? " |\n            " : "") << "hasZeroByte(w";
+                    if (stops[k] != 0) {
+                        oss << " ^ 0x" << hex << setw(16) << setfill('0')
+                            << 0x0101010101010101ULL * stops[k] << dec
+                            << setfill(' ') << "ULL";
+                    }
+                    oss << ")";
+                }
+                oss << ") {\n";
+                oss << "            break;\n";
+                oss << "        }\n";
+                oss << "    }\n";
+            }
+            oss << "    while (p < end && "
+                   "inSet[static_cast<unsigned char>(*p)]) {\n";
+            oss << "        p++;\n";
+            oss << "    }\n";
+            oss << "    return static_cast<int>(p - begin);\n";
+        }
+        oss << "}\n";
+        return oss.str();
+    }
+
+    // 状态按布局顺序编号，热状态的转换行在表中相邻
+    int stateId = static_cast<int>(layout.states.size());
+    int startStateId = layout.ids.at(dfa->start);
+
+    // 展开每个状态的转换行（-1表示无转换）
+    vector<vector<int>> rows(stateId, vector<int>(256, -1));
+    vector<int> stateIds;
+    for (int i = 0; i < stateId; i++) {
+        stateIds.push_back(i);
+        for (auto &pair : layout.states[i]->transitions) {
+            int b = static_cast<unsigned char>(pair.first);
+            rows[i][b] = layout.ids.at(pair.second);
+        }
+    }
+
+    // 表元素取能容纳所有状态编号的最窄整型
+    size_t stateBytes, baseBytes;
+    string stateType = narrowIntType(stateIds, &stateBytes);
+    CombTable comb = buildCombTable(rows);
+    string baseType = narrowIntType(comb.base, &baseBytes);
+    denseTableBytes += rows.size() * 256 * stateBytes;
+    combTableBytes += comb.base.size() * baseBytes +
+                      (comb.def.size() + comb.next.size() + comb.check.size()) *
+                          stateBytes;
+
+    // 走通用引擎的规则在步进表不超过体积上限时改用双字节步进
+    bool counting = !dfa->counters.empty();
+    vector<int> classes, pairs;
+    int classCount = 0;
+    bool stride2 = false;
+    if (stride2Budget > 0 && layout.directStates == 0 && !instrument &&
+        !memoize && !counting) {
+        vector<bool> accepting;
+        for (int i = 0; i < stateId; i++) {
+            accepting.push_back(layout.states[i]->isAccepting);
+        }
+        stride2 =
+            buildStride2Table(rows, accepting, classes, classCount, pairs);
+    }
+
+    string prefix = "dfa" + to_string(index);
+    tables << "// 规则: " << rule.tokenType << "\n";
+    if (!stride2) {
+        // 双字节步进表的表项已包含接受标记
+        tables << "static const bool " << prefix << "Accepting[" << stateId
+               << "] = {";
+        for (int i = 0; i < stateId; i++) {
+            if (i > 0)
+                tables << ", ";
+            tables << (layout.states[i]->isAccepting ? "true" : "false");
+        }
+        tables << "};\n";
+    }
+
+    // 计数状态的次数范围（普通状态为 -1）
+    if (counting) {
+        vector<int> counterMin, counterMax;
+        for (int i = 0; i < stateId; i++) {
+            auto it = dfa->counters.find(layout.states[i]);
+            counterMin.push_back(it != dfa->counters.end() ? it->second.min
+                                                           : -1);
+            counterMax.push_back(it != dfa->counters.end() ? it->second.max
+                                                           : -1);
+        }
+        size_t bytes;
+        emitIntArray(tables, narrowIntType(counterMin, &bytes),
+                     prefix + "CounterMin", counterMin);
+        emitIntArray(tables, narrowIntType(counterMax, &bytes),
+                     prefix + "CounterMax", counterMax);
+    }
+
+    if (stride2) {
+        size_t bytes;
+        stride2Rules.push_back(rule.tokenType);
+        emitIntArray(tables, narrowIntType(classes, &bytes), prefix + "Classes",
+                     classes);
+        emitIntArray(tables, narrowIntType(pairs, &bytes), prefix + "Pairs",
+                     pairs);
+    } else if (tableFormat == TableFormat::COMB) {
+        emitIntArray(tables, baseType, prefix + "Base", comb.base);
+        emitIntArray(tables, stateType, prefix + "Def", comb.def);
+        emitIntArray(tables, stateType, prefix + "Next", comb.next);
+        emitIntArray(tables, stateType, prefix + "Check", comb.check);
+    } else {
+        // 行按状态布局顺序连续存放
+        tables << "static const " << stateType << " " << prefix
+               << "Transitions[" << stateId << "][256] = {\n";
+        for (int i = 0; i < stateId; i++) {
+            tables << "    // 状态 " << i << "\n";
+            tables << "    {";
+            for (int b = 0; b < 256; b++) {
+                if (b > 0) {
+                    tables << (b % 32 == 0 ? ",\n     " : ", ");
+                }
+                tables << rows[i][b];
+            }
+            tables << "},\n";
+        }
+        tables << "};\n";
+    }
+    tables << "\n";
+
+    oss << "int Lexer::matchDFA" << index << "(size_t startPos) {\n";
+
+    // 没有直接编码、插桩、失败记忆和计数器的规则直接调用通用引擎
+    if (stride2) {
+        oss << "    return runStride2DFA(" << prefix << "Classes, "
+            << classCount << ", " << prefix << "Pairs, "
+            << startStateId * classCount * (classCount + 1)
+            << ", text, startPos);\n";
+        oss << "}\n";
+        return oss.str();
+    }
+    if (layout.directStates == 0 && !instrument && !memoize && !counting) {
+        if (tableFormat == TableFormat::COMB) {
+            oss << "    return runCombDFA(" << prefix << "Base, " << prefix
+                << "Def, " << prefix << "Next, " << prefix << "Check, "
+                << comb.check.size() << "u, " << prefix << "Accepting, "
+                << startStateId << ", text, startPos);\n";
+        } else {
+            oss << "    return runDenseDFA(" << prefix << "Transitions, "
+                << prefix << "Accepting, " << startStateId
+                << ", text, startPos);\n";
+        }
+        oss << "}\n";
+        return oss.str();
+    }
+
+    oss << "    const auto& accepting = " << prefix << "Accepting;\n";
+    if (counting) {
+        oss << "    const auto& counterMin = " << prefix << "CounterMin;\n";
+        oss << "    const auto& counterMax = " << prefix << "CounterMax;\n";
+    }
+    if (tableFormat == TableFormat::COMB) {
+        oss << "    const auto& base = " << prefix << "Base;\n";
+        oss << "    const auto& def = " << prefix << "Def;\n";
+        oss << "    const auto& next = " << prefix << "Next;\n";
+        oss << "    const auto& check = " << prefix << "Check;\n";
+    } else {
+        oss << "    const auto& transitions = " << prefix << "Transitions;\n";
+    }
+    oss << "    \n";
+
+    // 查表代码（稠密表或压缩表）
+    ostringstream lookup;
+    string indent = layout.directStates > 0 ? "            " : "        ";
+    if (tableFormat == TableFormat::COMB) {
+        lookup << indent << "int s = state;\n";
+        lookup << indent
+               << "while (s != -1 && (static_cast<unsigned>(base[s] + ch) >= "
+               << comb.check.size() << "u || check[base[s] + ch] != s)) {\n";
+        lookup << indent << "    s = def[s];\n";
+        lookup << indent << "}\n";
+        lookup << indent << "nextState = s == -1 ? -1 : next[base[s] + ch];\n";
+    } else {
+        lookup << indent << "nextState = transitions[state][ch];\n";
+    }
+
+    oss << "    int state = " << startStateId << ";\n";
+    oss << "    size_t currentPos = startPos;\n";
+    oss << "    size_t lastAcceptingPos = string::npos;\n";
+    if (counting) {
+        oss << "    int count = 0; // 连续停留在当前计数状态的步数\n";
+    }
+    if (instrument) {
+        oss << "    profileStateVisits" << index << "[state]++;\n";
+    }
+    if (memoize) {
+        oss << "    failed" << index << ".start(startPos);\n";
+        oss << "    munchTrail.clear();\n";
+        oss << "    size_t trailStart = startPos;\n";
+        oss << "    munchTrail.push_back(state);\n";
+    }
     oss << "    \n";
     oss << "    // 执行DFA匹配\n";
     oss << "    while (currentPos < text.length()) {\n";
+    if (memoize) {
+        oss << "        if (failed" << index
+            << ".failed(currentPos, state)) {\n";
+        oss << "            break; // 之前已证明从这里出发不会再接受\n";
+        oss << "        }\n";
+    }
     oss << "        unsigned char ch = static_cast<unsigned "
            "char>(text[currentPos]);\n";
-    oss << "        int nextState = transitions[state][ch];\n";
+    oss << "        int nextState;\n";
+    if (layout.directStates > 0) {
+        // 热状态直接编码为分支，其余状态查表
+        oss << "        switch (state) {\n";
+        for (int i = 0; i < layout.directStates; i++) {
+            oss << "        case " << i << ":\n";
+            emitDirectTransitions(oss, rows[i], "            ");
+            oss << "            break;\n";
+        }
+        oss << "        default: {\n";
+        oss << lookup.str();
+        oss << "            break;\n";
+        oss << "        }\n";
+        oss << "        }\n";
+    } else {
+        oss << lookup.str();
+    }
     oss << "        if (nextState == -1) {\n";
     oss << "            break;\n";
     oss << "        }\n";
+    if (counting) {
+        oss << "        if (nextState != state) {\n";
+        oss << "            if (count < counterMin[state]) {\n";
+        oss << "                break; // 计数重复的次数不足\n";
+        oss << "            }\n";
+        oss << "            count = 1;\n";
+        oss << "        } else if (counterMin[state] >= 0) {\n";
+        oss << "            if (count == counterMax[state]) {\n";
+        oss << "                break; // 计数重复已达上限\n";
+        oss << "            }\n";
+        oss << "            count++;\n";
+        oss << "        }\n";
+    }
     oss << "        state = nextState;\n";
     oss << "        currentPos++;\n";
-    oss << "        if (accepting[state]) {\n";
+    if (instrument) {
+        oss << "        profileStateVisits" << index << "[state]++;\n";
+    }
+    if (counting) {
+        oss << "        if (accepting[state] && count >= counterMin[state]) "
+               "{\n";
+    } else {
+        oss << "        if (accepting[state]) {\n";
+    }
     oss << "            lastAcceptingPos = currentPos;\n";
+    if (memoize) {
+        oss << "            munchTrail.clear();\n";
+        oss << "            trailStart = currentPos + 1;\n";
+        oss << "        } else {\n";
+        oss << "            munchTrail.push_back(state);\n";
+    }
     oss << "        }\n";
     oss << "    }\n";
     oss << "    \n";
+    if (memoize) {
+        oss << "    // 最后一次接受之后经过的 (状态, 位置) 都不可能再到达接受状态\n";
+        oss << "    failed" << index << ".mark(trailStart, munchTrail);\n";
+        oss << "    \n";
+    }
     oss << "    if (lastAcceptingPos != string::npos) {\n";
     oss << "        return static_cast<int>(lastAcceptingPos - startPos);\n";
     oss << "    }\n";
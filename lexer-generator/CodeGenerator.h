@@ -1,30 +1,164 @@
 #pragma once
 #include "DFA.h"
 #include "FileParser.h"
+#include <map>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
 using namespace std;
 
+// 转换表格式
+enum class TableFormat {
+    DENSE, // 稠密表 transitions[state][256]，查表最快
+    COMB   // 行位移压缩表（base/next/check/default），体积最小
+};
+
+// 行位移（comb）压缩后的转换表
+struct CombTable {
+    vector<int> base;  // 每个状态的行在 next/check 中的起始位置
+    vector<int> def;   // 默认状态：本行未存的字符沿默认状态查找（-1表示无）
+    vector<int> next;  // 目标状态
+    vector<int> check; // 该位置属于哪个状态（-1表示空闲）
+};
+
+// 某条规则的DFA在生成代码中的状态布局
+struct StateLayout {
+    vector<shared_ptr<DFAState>> states; // 按生成编号排列的状态
+    map<shared_ptr<DFAState>, int> ids;  // 状态 -> 生成编号
+    vector<int> canonicalIds;            // 生成编号 -> BFS规范编号
+    int directStates = 0; // 前 directStates 个热状态直接编码为分支
+};
+
 // 代码生成器：将DFA转换为可执行的词法分析器代码
 class CodeGenerator {
   public:
-    // 生成词法分析器代码
+    // 生成词法分析器实现文件（.cpp）的代码，头文件代码通过 getHeaderCode() 获取
     // rules: 词法规则列表
     // dfas: 每个规则对应的DFA
     string generateLexerCode(const vector<LexerRule> &rules,
                              const vector<shared_ptr<DFA>> &dfas);
 
+    // 最近一次生成的头文件（Token 和 Lexer 的声明）代码
+    const string &getHeaderCode() const { return headerCode; }
+
+    // 实现文件中 #include 的头文件名（默认 generated_lexer.h）
+    void setHeaderName(const string &name) { headerName = name; }
+
+    // 设置剖析数据：提供后按状态访问频率排列状态，热状态的转换行相邻存放，
+    // 最热的状态直接编码为分支，高频的单字节token走快速路径
+    void setProfile(const LexerProfile &p);
+
+    // 生成带计数器的词法分析器，可通过 writeProfile() 输出剖析文件
+    void setInstrument(bool enable) { instrument = enable; }
+
+    // 遇到无法识别的字节时不抛异常，而是返回覆盖整段非法输入的 ERROR 记号，
+    // 生成的代码可以用 -fno-exceptions 编译
+    void setErrorTokens(bool enable) { errorTokens = enable; }
+
+    // 设置转换表格式（默认稠密表）
+    void setTableFormat(TableFormat f) { tableFormat = f; }
+
+    // 最近一次生成中两种表格式的总字节数（用于比较体积）
+    size_t getDenseTableBytes() const { return denseTableBytes; }
+    size_t getCombTableBytes() const { return combTableBytes; }
+
+    // 最近一次生成中使用线性时间最长匹配（失败记忆）的规则
+    const vector<string> &getMemoizedRules() const { return memoizedRules; }
+
+    // 设置双字节步进表的体积上限（字节，0 表示不使用）：走通用引擎且步进表
+    // 不超过该体积的规则改用双字节步进的匹配引擎
+    void setStride2Budget(size_t bytes) { stride2Budget = bytes; }
+
+    // 最近一次生成中使用双字节步进的规则
+    const vector<string> &getStride2Rules() const { return stride2Rules; }
+
+    // 最近一次生成中按字节集合直接扫描（不查转换表）的规则
+    const vector<string> &getScanRules() const { return scanRules; }
+
   private:
-    // 生成Token结构定义
-    string generateTokenStruct();
+    LexerProfile profile;
+    long long totalStateVisits = 0;
+    long long totalTokens = 0;
+    bool instrument = false;
+    bool errorTokens = false;
+    TableFormat tableFormat = TableFormat::DENSE;
+    size_t denseTableBytes = 0;
+    size_t combTableBytes = 0;
+    vector<string> memoizedRules;
+    size_t stride2Budget = 0;
+    vector<string> stride2Rules;
+    vector<string> scanRules;
+    string headerName = "generated_lexer.h";
+    string headerCode;
 
-    // 生成Lexer类定义
+    // 判断规则的最长匹配回溯是否可能超线性：存在由非接受的活状态组成的环时，
+    // 越过最后接受位置的扫描长度没有上界
+    bool needsLinearMunch(shared_ptr<DFA> dfa);
+
+    // 行位移压缩：为每行选择默认行并把剩余差异项插入共享的 next/check 数组
+    CombTable buildCombTable(const vector<vector<int>> &rows);
+
+    // 从起始状态BFS得到规范状态顺序（按无符号字节值遍历转换，结果与指针地址无关）
+    vector<shared_ptr<DFAState>> bfsOrder(shared_ptr<DFA> dfa);
+
+    // 计算生成代码中的状态布局：默认BFS顺序，有剖析数据时按访问次数降序
+    StateLayout layoutStates(const LexerRule &rule, shared_ptr<DFA> dfa);
+
+    // 剖析数据中访问次数占全部状态访问至少 1% 的状态视为热状态
+    bool isHotState(long long visits) const;
+
+    // 剖析数据中匹配次数占全部token至少 1% 的token类型视为高频
+    bool isHotToken(const string &tokenType) const;
+
+    // 生成scanToken方法：匹配一个记号并写入给定的 Token
+    string generateNextToken(const vector<LexerRule> &rules,
+                             const vector<shared_ptr<DFA>> &dfas,
+                             const vector<bool> &multiline);
+
+    // 生成fillToken、nextToken、reset和tokenizeInto方法
+    string generateReuseMethods(const vector<LexerRule> &rules,
+                                const vector<bool> &memoized);
+
+    // 生成writeProfile方法（仅插桩模式）
+    string generateWriteProfile(const vector<LexerRule> &rules,
+                                const vector<StateLayout> &layouts);
+
+    // 是否有规则需要解码字面量
+    static bool hasDecode(const vector<LexerRule> &rules,
+                          LiteralDecode decode);
+
+    // 生成Token结构定义，有解码规则时带上存放二进制值的字段
+    string generateTokenStruct(const vector<LexerRule> &rules);
+
+    // 生成规则用到的字面量解码函数（SWAR一次转换8位数字）
+    string generateDecoders(const vector<LexerRule> &rules);
+
+    // 生成失败记忆的结构（放在头文件中，仅有规则需要线性时间最长匹配时）
+    string generateFailureMemo();
+
+    // 生成Lexer类声明（放在头文件中）
     string generateLexerClass(const vector<LexerRule> &rules,
-                              const vector<shared_ptr<DFA>> &dfas);
+                              const vector<StateLayout> &layouts,
+                              const vector<bool> &memoized,
+                              const vector<bool> &multiline);
+
+    // 生成通用的查表匹配引擎，没有直接编码、插桩和失败记忆的规则共用
+    string generateMatchEngine();
+
+    // 生成双字节步进的通用匹配引擎
+    string generateStride2Engine();
+
+    // 构造双字节步进表，体积超过 stride2Budget 时返回 false
+    bool buildStride2Table(const vector<vector<int>> &rows,
+                           const vector<bool> &accepting,
+                           vector<int> &classes, int &classCount,
+                           vector<int> &pairs);
 
-    // 为每个DFA生成匹配方法
+    // 为每个DFA生成匹配方法，转换表以文件作用域常量数组写入 tables
     string generateMatchMethod(int index, const LexerRule &rule,
-                               shared_ptr<DFA> dfa);
+                               shared_ptr<DFA> dfa,
+                               const StateLayout &layout, bool memoize,
+                               ostringstream &tables);
 };
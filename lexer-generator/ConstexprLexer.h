@@ -0,0 +1,990 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// 编译期词法分析器（C++20，header-only）
+//
+// 规则格式与 lexer_rules.txt 相同，整个规则文本作为字符串字面量模板参数传入；
+// 不支持交（&）、补（~）、不区分大小写和起始条件，使用时编译失败。
+// 正则解析、Thompson构造、子集构造和DFA最小化与 RegexParser / Thompson /
+// SubsetConstruction / DFAMinimizer 采用相同的算法，但全部在 constexpr
+// 中完成，转换表直接编译进二进制，不需要单独运行 lexer_generator。
+// 匹配语义与生成的词法分析器一致：跳过空白、最长匹配、长度相同时先出现的规则优先、
+// IGNORE 规则匹配成功即跳过。
+//
+// 用法：
+//   using MyLexer = ctlex::Lexer<R"(
+//   NUMBER  [0-9]+
+//   ID      [a-zA-Z_][a-zA-Z0-9_]*
+//   )">;
+//   MyLexer lexer(code);
+//   vector<ctlex::Token *> tokens = lexer.tokenize();
+//
+// 正则表达式有误时编译失败，错误信息中包含对应的 throw 语句。
+// 需要 g++ 12 及以上（constexpr std::vector），规则很多时可能需要调大
+// -fconstexpr-ops-limit。
+
+namespace ctlex {
+
+// 可作为模板参数的字符串字面量
+template <size_t N> struct FixedString {
+    char data[N];
+
+    constexpr FixedString(const char (&s)[N]) {
+        for (size_t i = 0; i < N; i++) {
+            data[i] = s[i];
+        }
+    }
+
+    constexpr size_t size() const { return N - 1; }
+    constexpr string_view view() const { return string_view(data, N - 1); }
+};
+
+struct Token {
+    string type;
+    string value;
+    int line;
+    int column;
+
+    Token(string t, string v, int l, int c)
+        : type(t), value(v), line(l), column(c) {}
+
+    string toString() const {
+        return "Token(" + type + ", " + value + ", " + to_string(line) + ", " +
+               to_string(column) + ")";
+    }
+};
+
+namespace detail {
+
+// 256位字节集合
+struct ByteSet {
+    uint64_t bits[4] = {0, 0, 0, 0};
+
+    constexpr void add(unsigned char b) { bits[b >> 6] |= 1ULL << (b & 63); }
+    constexpr bool has(unsigned char b) const {
+        return (bits[b >> 6] >> (b & 63)) & 1;
+    }
+    constexpr bool empty() const {
+        return (bits[0] | bits[1] | bits[2] | bits[3]) == 0;
+    }
+    constexpr bool intersects(const ByteSet &o) const {
+        return ((bits[0] & o.bits[0]) | (bits[1] & o.bits[1]) |
+                (bits[2] & o.bits[2]) | (bits[3] & o.bits[3])) != 0;
+    }
+    constexpr ByteSet intersect(const ByteSet &o) const {
+        ByteSet r;
+        for (int i = 0; i < 4; i++) {
+            r.bits[i] = bits[i] & o.bits[i];
+        }
+        return r;
+    }
+    constexpr ByteSet minus(const ByteSet &o) const {
+        ByteSet r;
+        for (int i = 0; i < 4; i++) {
+            r.bits[i] = bits[i] & ~o.bits[i];
+        }
+        return r;
+    }
+};
+
+// AST节点类型（与 RegexAST.h 一致）
+enum class NodeType { CHAR, CONCAT, UNION, STAR, PLUS, CHARSET, ANY, EPSILON };
+
+// AST节点：子节点用节点池下标引用；CHAR/CHARSET/ANY 统一展开为字节集合
+struct Node {
+    NodeType type = NodeType::EPSILON;
+    ByteSet chars;
+    int left = -1;  // CONCAT/UNION 的左子树，STAR/PLUS 的子树
+    int right = -1; // CONCAT/UNION 的右子树
+};
+
+// 正则表达式解析器（递归下降，语法同 RegexParser，但没有交、补和 (?i)）
+class RegexParser {
+  public:
+    constexpr RegexParser(string_view regex, vector<Node> &pool)
+        : input(regex), pos(0), nodes(pool) {}
+
+    constexpr int parse() {
+        int root = parseUnion();
+        if (!isEnd()) {
+            throw "正则表达式中有多余的右括号";
+        }
+        return root;
+    }
+
+  private:
+    string_view input;
+    size_t pos;
+    vector<Node> &nodes;
+
+    constexpr bool isEnd() const { return pos >= input.size(); }
+    constexpr char peek() const { return isEnd() ? '\0' : input[pos]; }
+    constexpr char advance() { return isEnd() ? '\0' : input[pos++]; }
+    constexpr bool match(char c) {
+        if (peek() == c) {
+            advance();
+            return true;
+        }
+        return false;
+    }
+
+    constexpr int makeNode(NodeType type, int left = -1, int right = -1) {
+        Node node;
+        node.type = type;
+        node.left = left;
+        node.right = right;
+        nodes.push_back(node);
+        return static_cast<int>(nodes.size()) - 1;
+    }
+
+    constexpr int makeChar(char c) {
+        int id = makeNode(NodeType::CHAR);
+        nodes[id].chars.add(static_cast<unsigned char>(c));
+        return id;
+    }
+
+    constexpr int parseUnion() {
+        int left = parseConcat();
+        while (match('|')) {
+            int right = parseConcat();
+            left = makeNode(NodeType::UNION, left, right);
+        }
+        return left;
+    }
+
+    constexpr int parseConcat() {
+        int left = -1;
+        while (!isEnd() && peek() != '|' && peek() != ')') {
+            int node = parseRepeat();
+            left = left == -1 ? node : makeNode(NodeType::CONCAT, left, node);
+        }
+        return left == -1 ? makeNode(NodeType::EPSILON) : left;
+    }
+
+    constexpr int parseRepeat() {
+        if (peek() == '~') {
+            throw "编译期词法分析器不支持补（~）";
+        }
+        int atom = parseAtom();
+        while (true) {
+            if (match('*')) {
+                atom = makeNode(NodeType::STAR, atom);
+            } else if (match('+')) {
+                atom = makeNode(NodeType::PLUS, atom);
+            } else if (match('?')) {
+                atom = makeNode(NodeType::UNION, atom,
+                                makeNode(NodeType::EPSILON));
+            } else if (peek() == '{' && pos + 1 < input.size() &&
+                       isDigit(input[pos + 1])) {
+                // {n}、{m,}、{m,n}；{ 后面不是数字时按普通字符处理
+                advance(); // 跳过 '{'
+                int min = parseCount();
+                int max = min;
+                if (match(',')) {
+                    max = peek() == '}' ? -1 : parseCount();
+                }
+                if (!match('}')) {
+                    throw "重复次数缺少右花括号";
+                }
+                if (max != -1 && min > max) {
+                    throw "重复次数范围无效: 下限大于上限";
+                }
+                atom = expandRepeat(atom, min, max);
+            } else {
+                break;
+            }
+        }
+        return atom;
+    }
+
+    static constexpr bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+    constexpr int parseCount() {
+        int count = 0;
+        while (isDigit(peek())) {
+            count = count * 10 + (advance() - '0');
+            if (count > 100000) {
+                throw "重复次数过大（最多 100000）";
+            }
+        }
+        return count;
+    }
+
+    // 展开计数重复：min 个必选的 atom，之后是 max - min 个可选的 atom
+    // （max 为 -1 时是 atom*）。各个副本共用 atom 的子树，Thompson构造
+    // 对每次引用分别生成状态
+    constexpr int expandRepeat(int atom, int min, int max) {
+        int result = -1;
+        auto append = [&](int node) {
+            result = result == -1 ? node
+                                  : makeNode(NodeType::CONCAT, result, node);
+        };
+        for (int i = 0; i < min; i++) {
+            append(atom);
+        }
+        if (max == -1) {
+            append(makeNode(NodeType::STAR, atom));
+        } else {
+            for (int i = min; i < max; i++) {
+                append(makeNode(NodeType::UNION, atom,
+                                makeNode(NodeType::EPSILON)));
+            }
+        }
+        return result == -1 ? makeNode(NodeType::EPSILON) : result;
+    }
+
+    constexpr int parseAtom() {
+        char ch = peek();
+
+        // 不支持交、补和不区分大小写，编译失败而不是当作普通字符
+        if (ch == '&') {
+            throw "编译期词法分析器不支持交（&）";
+        }
+        if (input.substr(pos, 3) == "(?i") {
+            throw "编译期词法分析器不支持不区分大小写（(?i)）";
+        }
+
+        if (match('(')) {
+            int node = parseUnion();
+            if (!match(')')) {
+                throw "缺少右括号";
+            }
+            return node;
+        }
+
+        if (match('[')) {
+            int node = parseCharset();
+            if (!match(']')) {
+                throw "缺少右中括号";
+            }
+            return node;
+        }
+
+        if (match('\\')) {
+            if (isEnd()) {
+                throw "转义字符后缺少字符";
+            }
+            char escaped = advance();
+            switch (escaped) {
+            case 'n':
+                return makeChar('\n');
+            case 't':
+                return makeChar('\t');
+            case 'r':
+                return makeChar('\r');
+            default:
+                return makeChar(escaped);
+            }
+        }
+
+        // 任意字符（除换行符和 '\0'，与 Thompson::buildAny 一致）
+        if (match('.')) {
+            int id = makeNode(NodeType::ANY);
+            for (int b = 1; b < 256; b++) {
+                if (b != '\n') {
+                    nodes[id].chars.add(static_cast<unsigned char>(b));
+                }
+            }
+            return id;
+        }
+
+        if (ch != '\0' && ch != '|' && ch != '(' && ch != ')' && ch != '*' &&
+            ch != '+' && ch != '?') {
+            advance();
+            return makeChar(ch);
+        }
+
+        throw "无法解析的正则表达式字符";
+    }
+
+    constexpr char charsetChar() {
+        if (match('\\')) {
+            if (isEnd()) {
+                throw "转义字符后缺少字符";
+            }
+        }
+        return advance();
+    }
+
+    constexpr int parseCharset() {
+        int id = makeNode(NodeType::CHARSET);
+        ByteSet chars;
+        bool negated = false;
+
+        if (peek() == '^') {
+            negated = true;
+            advance();
+        }
+
+        while (!isEnd() && peek() != ']') {
+            char start = charsetChar();
+            if (peek() == '-' && pos + 1 < input.size() &&
+                input[pos + 1] != ']') {
+                advance();
+                char end = charsetChar();
+                if (start > end) {
+                    throw "字符类范围无效: 起始字符大于结束字符";
+                }
+                for (int c = start; c <= end; c++) {
+                    chars.add(static_cast<unsigned char>(c));
+                }
+            } else {
+                chars.add(static_cast<unsigned char>(start));
+            }
+        }
+
+        if (negated) {
+            // 取反字符类不匹配换行符和 '\0'，与 Thompson::buildCharset 一致
+            for (int b = 1; b < 256; b++) {
+                if (b != '\n' && !chars.has(static_cast<unsigned char>(b))) {
+                    nodes[id].chars.add(static_cast<unsigned char>(b));
+                }
+            }
+        } else {
+            nodes[id].chars = chars;
+        }
+        return id;
+    }
+};
+
+// NFA状态：至多一条字节集合边和两条epsilon边
+struct NFAState {
+    ByteSet on;
+    int target = -1;
+    int eps[2] = {-1, -1};
+    int epsCount = 0;
+
+    constexpr void addEpsilon(int to) { eps[epsCount++] = to; }
+};
+
+struct Fragment {
+    int start;
+    int accept;
+};
+
+// Thompson构造（同 ThompsonConstruction）
+class Thompson {
+  public:
+    constexpr Thompson(const vector<Node> &pool, vector<NFAState> &states)
+        : nodes(pool), nfa(states) {}
+
+    constexpr Fragment build(int id) {
+        const Node &node = nodes[id];
+        switch (node.type) {
+        case NodeType::CHAR:
+        case NodeType::ANY:
+        case NodeType::CHARSET: {
+            Fragment f = newFragment();
+            if (node.chars.empty()) {
+                nfa[f.start].addEpsilon(f.accept);
+            } else {
+                nfa[f.start].on = node.chars;
+                nfa[f.start].target = f.accept;
+            }
+            return f;
+        }
+        case NodeType::CONCAT: {
+            Fragment left = build(node.left);
+            Fragment right = build(node.right);
+            nfa[left.accept].addEpsilon(right.start);
+            return Fragment{left.start, right.accept};
+        }
+        case NodeType::UNION: {
+            Fragment left = build(node.left);
+            Fragment right = build(node.right);
+            Fragment f = newFragment();
+            nfa[f.start].addEpsilon(left.start);
+            nfa[f.start].addEpsilon(right.start);
+            nfa[left.accept].addEpsilon(f.accept);
+            nfa[right.accept].addEpsilon(f.accept);
+            return f;
+        }
+        case NodeType::STAR: {
+            Fragment child = build(node.left);
+            Fragment f = newFragment();
+            nfa[f.start].addEpsilon(child.start);
+            nfa[f.start].addEpsilon(f.accept);
+            nfa[child.accept].addEpsilon(child.start);
+            nfa[child.accept].addEpsilon(f.accept);
+            return f;
+        }
+        case NodeType::PLUS: {
+            Fragment child = build(node.left);
+            Fragment f = newFragment();
+            nfa[f.start].addEpsilon(child.start);
+            nfa[child.accept].addEpsilon(child.start);
+            nfa[child.accept].addEpsilon(f.accept);
+            return f;
+        }
+        case NodeType::EPSILON:
+        default: {
+            Fragment f = newFragment();
+            nfa[f.start].addEpsilon(f.accept);
+            return f;
+        }
+        }
+    }
+
+  private:
+    const vector<Node> &nodes;
+    vector<NFAState> &nfa;
+
+    constexpr Fragment newFragment() {
+        nfa.push_back(NFAState());
+        nfa.push_back(NFAState());
+        int s = static_cast<int>(nfa.size());
+        return Fragment{s - 2, s - 1};
+    }
+};
+
+// 单条规则的最小化DFA：状态0为起始状态，next[state * classCount + class]
+struct RuleDFA {
+    int stateCount = 0;
+    vector<bool> accepting;
+    vector<int> next;
+};
+
+// 解析后的规则
+struct RuleSpec {
+    size_t nameBegin = 0;
+    size_t nameLength = 0;
+    size_t regexBegin = 0;
+    size_t regexLength = 0;
+    bool ignore = false;
+    vector<NFAState> nfa;
+    Fragment fragment{0, 0};
+    RuleDFA dfa;
+};
+
+// 整个规则集的构建结果
+struct RuleSet {
+    vector<RuleSpec> rules;
+    int classOf[256] = {};
+    int classCount = 1;
+    int totalStates = 0;
+};
+
+constexpr bool isSpace(char c) {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// 按 FileParser::readLexerRules 的规则切分规则文本
+constexpr vector<RuleSpec> parseRules(string_view text) {
+    vector<RuleSpec> rules;
+    size_t lineBegin = 0;
+    while (lineBegin < text.size()) {
+        size_t lineEnd = text.find('\n', lineBegin);
+        if (lineEnd == string_view::npos) {
+            lineEnd = text.size();
+        }
+        string_view line = text.substr(lineBegin, lineEnd - lineBegin);
+        size_t offset = lineBegin;
+        lineBegin = lineEnd + 1;
+
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        size_t i = 0;
+        while (i < line.size() && isSpace(line[i])) {
+            i++;
+        }
+        if (i == line.size() || line[0] == '#') {
+            continue;
+        }
+
+        if (line[i] == '<') {
+            throw "编译期词法分析器不支持起始条件";
+        }
+
+        RuleSpec rule;
+        rule.nameBegin = offset + i;
+        while (i < line.size() && !isSpace(line[i])) {
+            i++;
+        }
+        rule.nameLength = offset + i - rule.nameBegin;
+
+        string_view rest = line.substr(i);
+        size_t b = 0;
+        while (b < rest.size() && isSpace(rest[b])) {
+            b++;
+        }
+        size_t e = rest.size();
+        while (e > b && isSpace(rest[e - 1])) {
+            e--;
+        }
+
+        // 行尾的标记：解码标记不起作用（Token 只有 value），不支持 ICASE
+        // 和 PUSH/POP
+        rule.ignore = false;
+        while (true) {
+            size_t space = e;
+            while (space > b && !isSpace(rest[space - 1])) {
+                space--;
+            }
+            if (space == b) {
+                break;
+            }
+            string_view flag = rest.substr(space, e - space);
+            if (flag == "IGNORE") {
+                rule.ignore = true;
+            } else if (flag == "ICASE") {
+                throw "编译期词法分析器不支持 ICASE";
+            } else if (flag == "POP" || flag.substr(0, 5) == "PUSH(") {
+                throw "编译期词法分析器不支持起始条件";
+            } else if (flag != "INT64" && flag != "DOUBLE" &&
+                       flag != "UNESCAPE" && flag != "INTERN") {
+                break;
+            }
+            e = space;
+            while (e > b && isSpace(rest[e - 1])) {
+                e--;
+            }
+        }
+        rule.regexBegin = offset + i + b;
+        rule.regexLength = e - b;
+        rules.push_back(rule);
+    }
+    return rules;
+}
+
+// 计算NFA状态集合的epsilon闭包（集合用位图表示）
+constexpr void epsilonClosure(const vector<NFAState> &nfa,
+                              vector<uint64_t> &set) {
+    vector<int> work;
+    for (size_t s = 0; s < nfa.size(); s++) {
+        if ((set[s >> 6] >> (s & 63)) & 1) {
+            work.push_back(static_cast<int>(s));
+        }
+    }
+    while (!work.empty()) {
+        int s = work.back();
+        work.pop_back();
+        for (int k = 0; k < nfa[s].epsCount; k++) {
+            int t = nfa[s].eps[k];
+            if (!((set[t >> 6] >> (t & 63)) & 1)) {
+                set[t >> 6] |= 1ULL << (t & 63);
+                work.push_back(t);
+            }
+        }
+    }
+}
+
+// 子集构造 + 等价类划分最小化，结果按BFS顺序编号
+constexpr RuleDFA buildRuleDFA(const RuleSpec &rule,
+                               const vector<ByteSet> &classes) {
+    int classCount = static_cast<int>(classes.size());
+    const vector<NFAState> &nfa = rule.nfa;
+    size_t words = (nfa.size() + 63) / 64;
+
+    // 每个NFA状态的字节边覆盖哪些字节类
+    vector<vector<int>> edgeClasses(nfa.size());
+    for (size_t s = 0; s < nfa.size(); s++) {
+        if (nfa[s].target == -1) {
+            continue;
+        }
+        for (int c = 0; c < classCount; c++) {
+            if (nfa[s].on.intersects(classes[c])) {
+                edgeClasses[s].push_back(c);
+            }
+        }
+    }
+
+    // 子集构造
+    vector<vector<uint64_t>> sets;
+    vector<int> next; // sets.size() * classCount
+    vector<bool> accepting;
+
+    vector<uint64_t> initial(words, 0);
+    initial[rule.fragment.start >> 6] |= 1ULL << (rule.fragment.start & 63);
+    epsilonClosure(nfa, initial);
+    sets.push_back(initial);
+
+    for (size_t d = 0; d < sets.size(); d++) {
+        const vector<uint64_t> current = sets[d];
+        accepting.push_back(
+            (current[rule.fragment.accept >> 6] >> (rule.fragment.accept & 63)) &
+            1);
+
+        // 一次遍历集合中的状态，同时计算所有字节类上的move
+        // moved按字节类平铺存放，避免每个DFA状态分配classCount个vector
+        vector<uint64_t> moved(classCount * words, 0);
+        vector<bool> any(classCount, false);
+        for (size_t s = 0; s < nfa.size(); s++) {
+            if (!((current[s >> 6] >> (s & 63)) & 1)) {
+                continue;
+            }
+            int t = nfa[s].target;
+            for (int c : edgeClasses[s]) {
+                moved[c * words + (t >> 6)] |= 1ULL << (t & 63);
+                any[c] = true;
+            }
+        }
+
+        for (int c = 0; c < classCount; c++) {
+            if (!any[c]) {
+                next.push_back(-1);
+                continue;
+            }
+            vector<uint64_t> target(moved.begin() + c * words,
+                                    moved.begin() + (c + 1) * words);
+            epsilonClosure(nfa, target);
+            int found = -1;
+            for (size_t k = 0; k < sets.size() && found == -1; k++) {
+                if (sets[k] == target) {
+                    found = static_cast<int>(k);
+                }
+            }
+            if (found == -1) {
+                sets.push_back(target);
+                found = static_cast<int>(sets.size()) - 1;
+            }
+            next.push_back(found);
+        }
+    }
+
+    // 等价类划分：初始按是否接受划分，按转换目标所在划分反复细化
+    int n = static_cast<int>(sets.size());
+    vector<int> group(n, 0);
+    int groupCount = 1;
+    bool hasAccepting = false, hasNonAccepting = false;
+    for (int s = 0; s < n; s++) {
+        group[s] = accepting[s] ? 0 : 1;
+        hasAccepting = hasAccepting || accepting[s];
+        hasNonAccepting = hasNonAccepting || !accepting[s];
+    }
+    if (hasAccepting && hasNonAccepting) {
+        groupCount = 2;
+    } else {
+        // 全部是接受状态（或全部不是）时仍要按转换细化
+        for (int s = 0; s < n; s++) {
+            group[s] = 0;
+        }
+    }
+    while (true) {
+        vector<int> newGroup(n, -1);
+        int newCount = 0;
+        for (int s = 0; s < n; s++) {
+            if (newGroup[s] != -1) {
+                continue;
+            }
+            newGroup[s] = newCount;
+            for (int t = s + 1; t < n; t++) {
+                if (newGroup[t] != -1 || group[t] != group[s]) {
+                    continue;
+                }
+                bool same = true;
+                for (int c = 0; c < classCount && same; c++) {
+                    int a = next[s * classCount + c];
+                    int b = next[t * classCount + c];
+                    same = (a == -1 ? -1 : group[a]) ==
+                           (b == -1 ? -1 : group[b]);
+                }
+                if (same) {
+                    newGroup[t] = newCount;
+                }
+            }
+            newCount++;
+        }
+        group = newGroup;
+        if (newCount == groupCount) {
+            break;
+        }
+        groupCount = newCount;
+    }
+
+    // 每个划分选一个代表状态，从起始状态BFS重新编号
+    vector<int> repOf(groupCount, -1);
+    for (int s = 0; s < n; s++) {
+        if (repOf[group[s]] == -1) {
+            repOf[group[s]] = s;
+        }
+    }
+    vector<int> order;
+    vector<int> newId(groupCount, -1);
+    order.push_back(group[0]);
+    newId[group[0]] = 0;
+    for (size_t k = 0; k < order.size(); k++) {
+        int rep = repOf[order[k]];
+        for (int c = 0; c < classCount; c++) {
+            int t = next[rep * classCount + c];
+            if (t != -1 && newId[group[t]] == -1) {
+                newId[group[t]] = static_cast<int>(order.size());
+                order.push_back(group[t]);
+            }
+        }
+    }
+
+    RuleDFA dfa;
+    dfa.stateCount = static_cast<int>(order.size());
+    for (int g : order) {
+        int rep = repOf[g];
+        dfa.accepting.push_back(accepting[rep]);
+        for (int c = 0; c < classCount; c++) {
+            int t = next[rep * classCount + c];
+            dfa.next.push_back(t == -1 ? -1 : newId[group[t]]);
+        }
+    }
+    return dfa;
+}
+
+// 构建整个规则集：解析规则、Thompson构造、计算共享字节类、逐条构建DFA
+constexpr RuleSet buildRuleSet(string_view text) {
+    RuleSet set;
+    set.rules = parseRules(text);
+
+    for (RuleSpec &rule : set.rules) {
+        vector<Node> nodes;
+        RegexParser parser(text.substr(rule.regexBegin, rule.regexLength),
+                           nodes);
+        int root = parser.parse();
+        Thompson thompson(nodes, rule.nfa);
+        rule.fragment = thompson.build(root);
+    }
+
+    // 所有字节集合共同细化出的字节类：同一类中的字节在所有规则中行为相同
+    vector<ByteSet> classes(1);
+    for (int b = 0; b < 256; b++) {
+        classes[0].add(static_cast<unsigned char>(b));
+    }
+    // 先对边上的字节集合去重，大量规则共享同样的字符集
+    vector<ByteSet> edgeSets;
+    for (const RuleSpec &rule : set.rules) {
+        for (const NFAState &state : rule.nfa) {
+            if (state.target == -1) {
+                continue;
+            }
+            bool seen = false;
+            for (size_t k = 0; k < edgeSets.size() && !seen; k++) {
+                seen = edgeSets[k].bits[0] == state.on.bits[0] &&
+                       edgeSets[k].bits[1] == state.on.bits[1] &&
+                       edgeSets[k].bits[2] == state.on.bits[2] &&
+                       edgeSets[k].bits[3] == state.on.bits[3];
+            }
+            if (!seen) {
+                edgeSets.push_back(state.on);
+            }
+        }
+    }
+    for (const ByteSet &on : edgeSets) {
+        vector<ByteSet> refined;
+        for (const ByteSet &k : classes) {
+            ByteSet in = k.intersect(on);
+            ByteSet out = k.minus(on);
+            if (!in.empty()) {
+                refined.push_back(in);
+            }
+            if (!out.empty()) {
+                refined.push_back(out);
+            }
+        }
+        classes = refined;
+    }
+    set.classCount = static_cast<int>(classes.size());
+    for (int c = 0; c < set.classCount; c++) {
+        for (int b = 0; b < 256; b++) {
+            if (classes[c].has(static_cast<unsigned char>(b))) {
+                set.classOf[b] = c;
+            }
+        }
+    }
+
+    for (RuleSpec &rule : set.rules) {
+        rule.dfa = buildRuleDFA(rule, classes);
+        set.totalStates += rule.dfa.stateCount;
+    }
+    return set;
+}
+
+struct Sizes {
+    size_t ruleCount;
+    size_t stateCount;
+    size_t classCount;
+};
+
+template <size_t R, size_t S, size_t C> struct Tables {
+    array<uint8_t, 256> classOf{};
+    array<int, R + 1> offset{};       // 规则 r 的状态为 [offset[r], offset[r+1])
+    array<bool, S> accepting{};       // 按全局状态编号
+    array<int, S * C> next{};         // 全局状态编号，-1 表示无转换
+    array<ByteSet, R> firstBytes{};   // 规则可能开头的字节
+    array<size_t, R> nameBegin{};
+    array<size_t, R> nameLength{};
+    array<bool, R> ignore{};
+};
+
+} // namespace detail
+
+template <FixedString Rules> class Lexer {
+  private:
+    static constexpr detail::Sizes sizes = [] {
+        detail::RuleSet set = detail::buildRuleSet(Rules.view());
+        return detail::Sizes{set.rules.size(),
+                             static_cast<size_t>(set.totalStates),
+                             static_cast<size_t>(set.classCount)};
+    }();
+
+    static constexpr size_t R = sizes.ruleCount;
+    static constexpr size_t S = sizes.stateCount;
+    static constexpr size_t C = sizes.classCount;
+
+    static_assert(R > 0, "规则文本中没有规则");
+    static_assert(C <= 256, "字节类数目超过256");
+
+    // 编译期生成的转换表
+    static constexpr detail::Tables<R, S, C> tables = [] {
+        detail::RuleSet set = detail::buildRuleSet(Rules.view());
+        detail::Tables<R, S, C> t;
+        for (int b = 0; b < 256; b++) {
+            t.classOf[b] = static_cast<uint8_t>(set.classOf[b]);
+        }
+        int offset = 0;
+        for (size_t r = 0; r < R; r++) {
+            const detail::RuleSpec &rule = set.rules[r];
+            t.offset[r] = offset;
+            t.nameBegin[r] = rule.nameBegin;
+            t.nameLength[r] = rule.nameLength;
+            t.ignore[r] = rule.ignore;
+            for (int s = 0; s < rule.dfa.stateCount; s++) {
+                t.accepting[offset + s] = rule.dfa.accepting[s];
+                for (size_t c = 0; c < C; c++) {
+                    int target = rule.dfa.next[s * C + c];
+                    t.next[(offset + s) * C + c] =
+                        target == -1 ? -1 : offset + target;
+                }
+            }
+            for (int b = 0; b < 256; b++) {
+                if (rule.dfa.next[set.classOf[b]] != -1) {
+                    t.firstBytes[r].add(static_cast<unsigned char>(b));
+                }
+            }
+            offset += rule.dfa.stateCount;
+        }
+        t.offset[R] = offset;
+        return t;
+    }();
+
+    string text;
+    size_t pos;
+    int line;
+    int column;
+
+    // 第 I 条规则从 startPos 开始的最长匹配长度（0表示不匹配）
+    template <size_t I> int matchRule(size_t startPos) const {
+        int state = tables.offset[I];
+        size_t currentPos = startPos;
+        size_t lastAcceptingPos = string::npos;
+        while (currentPos < text.length()) {
+            unsigned char ch = static_cast<unsigned char>(text[currentPos]);
+            int nextState = tables.next[state * C + tables.classOf[ch]];
+            if (nextState == -1) {
+                break;
+            }
+            state = nextState;
+            currentPos++;
+            if (tables.accepting[state]) {
+                lastAcceptingPos = currentPos;
+            }
+        }
+        if (lastAcceptingPos != string::npos) {
+            return static_cast<int>(lastAcceptingPos - startPos);
+        }
+        return 0;
+    }
+
+    // 尝试第 I 条规则；IGNORE 规则匹配成功时返回 true
+    template <size_t I>
+    bool tryRule(unsigned char first, int &longestLength, int &matchedRule) {
+        if (!tables.firstBytes[I].has(first)) {
+            return false;
+        }
+        int length = matchRule<I>(pos);
+        if (tables.ignore[I]) {
+            if (length > 0) {
+                pos += length;
+                column += length;
+                return true;
+            }
+        } else if (length > longestLength) {
+            longestLength = length;
+            matchedRule = static_cast<int>(I);
+        }
+        return false;
+    }
+
+  public:
+    Lexer(const string &input) : text(input), pos(0), line(1), column(1) {}
+
+    // 规则数、DFA状态总数和字节类数
+    static constexpr size_t ruleCount() { return R; }
+    static constexpr size_t stateCount() { return S; }
+    static constexpr size_t classCount() { return C; }
+
+    Token *nextToken() {
+        while (true) {
+            // 跳过空白字符
+            while (pos < text.length() && detail::isSpace(text[pos])) {
+                if (text[pos] == '\n') {
+                    line++;
+                    column = 1;
+                } else {
+                    column++;
+                }
+                pos++;
+            }
+
+            if (pos >= text.length()) {
+                return nullptr;
+            }
+
+            unsigned char first = static_cast<unsigned char>(text[pos]);
+            int longestLength = 0;
+            int matchedRule = -1;
+
+            // 按规则顺序展开尝试，IGNORE 规则匹配成功后不再尝试后续规则
+            bool ignored = [&]<size_t... I>(index_sequence<I...>) {
+                return (tryRule<I>(first, longestLength, matchedRule) || ...);
+            }(make_index_sequence<R>{});
+            if (ignored) {
+                continue;
+            }
+
+            if (longestLength > 0) {
+                string type(Rules.data + tables.nameBegin[matchedRule],
+                            tables.nameLength[matchedRule]);
+                Token *token = new Token(type, text.substr(pos, longestLength),
+                                         line, column);
+                pos += longestLength;
+                column += longestLength;
+                return token;
+            }
+
+            throw runtime_error("Unexpected character '" + string(1, text[pos]) +
+                                "' at line " + to_string(line) + ", column " +
+                                to_string(column));
+        }
+    }
+
+    vector<Token *> tokenize() {
+        vector<Token *> tokens;
+        while (pos < text.length()) {
+            Token *token = nextToken();
+            if (token) {
+                tokens.push_back(token);
+            } else {
+                break;
+            }
+        }
+        return tokens;
+    }
+};
+
+} // namespace ctlex
@@ -0,0 +1,245 @@
+#include "Counting.h"
+#include "DFAMinimizer.h"
+#include "Derivative.h"
+#include <queue>
+
+using namespace std;
+
+CountingConstruction::CountingConstruction(int threshold)
+    : threshold(threshold), nextId(0) {}
+
+shared_ptr<DFA> CountingConstruction::build(shared_ptr<ASTNode> ast) {
+    pieces.clear();
+    counted.clear();
+    begins.clear();
+    nextId = 0;
+
+    // 1. 按顶层连接拆分为 P0 C1 P1 ... Ck Pk
+    vector<shared_ptr<ASTNode>> factors;
+    flatten(ast, factors);
+    pieces.push_back(Piece{{}, nullptr, true, {}});
+    for (auto factor : factors) {
+        bitset<256> chars;
+        if (factor->type == NodeType::REPEAT) {
+            auto repeat = dynamic_pointer_cast<RepeatNode>(factor);
+            int bound = repeat->max == -1 ? repeat->min : repeat->max;
+            if (bound >= threshold && charClass(repeat->child, chars)) {
+                // 与其他构造一致：'\0' 表示epsilon，集合含 '\0' 时下限相当于0
+                int min = chars.test(0) ? 0 : repeat->min;
+                chars.reset(0);
+                if (chars.any()) {
+                    counted.push_back(
+                        Counted{chars, min, repeat->max, nullptr});
+                    pieces.push_back(Piece{{}, nullptr, true, {}});
+                    continue;
+                }
+            }
+        }
+        pieces.back().factors.push_back(factor);
+    }
+    if (counted.empty()) {
+        return nullptr;
+    }
+
+    // 2. 构造各段普通子表达式的最小DFA，并检查拼接条件
+    DFAMinimizer minimizer;
+    size_t k = counted.size();
+    for (size_t i = 0; i <= k; i++) {
+        Piece &piece = pieces[i];
+        if (!piece.factors.empty()) {
+            auto ast = piece.factors.size() == 1
+                           ? piece.factors[0]
+                           : make_shared<ConcatNode>(piece.factors);
+            DerivativeConstruction derivative;
+            piece.dfa = minimizer.minimize(derivative.build(ast));
+            piece.empty = piece.dfa->start->isAccepting &&
+                          piece.dfa->start->transitions.empty();
+        }
+        if (piece.empty || i == k) {
+            continue;
+        }
+        if (piece.dfa->start->isAccepting) {
+            return nullptr; // 中间段可以匹配空串
+        }
+        for (auto state : piece.dfa->states) {
+            if (state->isAccepting && !state->transitions.empty()) {
+                return nullptr; // 中间段不是无前缀的
+            }
+        }
+    }
+
+    // 3. 创建状态：中间段的接受状态合并为下一个计数重复之前的状态
+    for (size_t i = 0; i < k; i++) {
+        begins.push_back(i == 0 || !pieces[i].empty ? newState() : nullptr);
+        counted[i].loop = newState();
+    }
+    for (size_t i = 0; i <= k; i++) {
+        Piece &piece = pieces[i];
+        if (piece.empty) {
+            continue;
+        }
+        for (auto state : piece.dfa->states) {
+            piece.copies[state] =
+                state->isAccepting && i < k ? begins[i] : newState();
+        }
+    }
+
+    // 4. 填写转换：段内转换照抄，拼接处的转换由后续表达式的首步得到
+    for (size_t i = 0; i <= k; i++) {
+        Piece &piece = pieces[i];
+        if (piece.empty) {
+            continue;
+        }
+        for (auto state : piece.dfa->states) {
+            auto copy = piece.copies[state];
+            if (i < k && state->isAccepting) {
+                continue;
+            }
+            copy->isAccepting = state->isAccepting;
+            for (auto &t : state->transitions) {
+                copy->addTransition(t.first, piece.copies[t.second]);
+            }
+        }
+    }
+    for (size_t i = 0; i < k; i++) {
+        if (begins[i]) {
+            Transitions out;
+            bool accepting;
+            if (!entry(i, out, accepting)) {
+                return nullptr;
+            }
+            begins[i]->transitions = out;
+            begins[i]->isAccepting = accepting;
+        }
+
+        Transitions out;
+        bool accepting;
+        if (!continuation(i + 1, out, accepting)) {
+            return nullptr;
+        }
+        if (!merge(out, loopTransitions(counted[i]))) {
+            return nullptr; // 无法确定是否继续计数
+        }
+        counted[i].loop->transitions = out;
+        counted[i].loop->isAccepting = accepting;
+    }
+
+    // 5. 只保留从起始状态可达的状态（各段的起始状态只被复制了出边）
+    auto start = pieces[0].empty ? begins[0]
+                                 : pieces[0].copies[pieces[0].dfa->start];
+    auto dfa = make_shared<DFA>(start);
+    queue<shared_ptr<DFAState>> workQueue;
+    workQueue.push(start);
+    while (!workQueue.empty()) {
+        auto state = workQueue.front();
+        workQueue.pop();
+        for (auto &t : state->transitions) {
+            if (dfa->states.insert(t.second).second) {
+                workQueue.push(t.second);
+            }
+        }
+    }
+    for (const auto &c : counted) {
+        if (dfa->states.count(c.loop)) {
+            dfa->counters[c.loop] = CounterRange{c.min, c.max};
+        }
+    }
+    return dfa;
+}
+
+void CountingConstruction::flatten(shared_ptr<ASTNode> node,
+                                   vector<shared_ptr<ASTNode>> &factors) {
+    if (node->type == NodeType::CONCAT) {
+        for (auto child : dynamic_pointer_cast<ConcatNode>(node)->children) {
+            flatten(child, factors);
+        }
+    } else if (node->type != NodeType::EPSILON) {
+        factors.push_back(node);
+    }
+}
+
+bool CountingConstruction::charClass(shared_ptr<ASTNode> node,
+                                     bitset<256> &chars) {
+    chars.reset();
+    switch (node->type) {
+    case NodeType::CHAR:
+        chars.set(static_cast<unsigned char>(
+            dynamic_pointer_cast<CharNode>(node)->ch));
+        return true;
+    case NodeType::CHARSET: {
+        auto charset = dynamic_pointer_cast<CharsetNode>(node);
+        for (char ch : charset->chars) {
+            chars.set(static_cast<unsigned char>(ch));
+        }
+        if (charset->negated) {
+            chars.flip();
+            chars.reset('\n');
+            chars.reset(0);
+        }
+        return true;
+    }
+    case NodeType::ANY:
+        chars.set();
+        chars.reset('\n');
+        chars.reset(0);
+        return true;
+    default:
+        return false;
+    }
+}
+
+shared_ptr<DFAState> CountingConstruction::newState() {
+    return make_shared<DFAState>(nextId++);
+}
+
+bool CountingConstruction::merge(Transitions &into, const Transitions &from) {
+    for (auto &t : from) {
+        auto it = into.find(t.first);
+        if (it != into.end() && it->second != t.second) {
+            return false;
+        }
+        into[t.first] = t.second;
+    }
+    return true;
+}
+
+bool CountingConstruction::continuation(size_t j, Transitions &out,
+                                        bool &accepting) {
+    Piece &piece = pieces[j];
+    if (piece.empty) {
+        if (j == counted.size()) {
+            out.clear();
+            accepting = true;
+            return true;
+        }
+        return entry(j, out, accepting);
+    }
+    out.clear();
+    for (auto &t : piece.dfa->start->transitions) {
+        out[t.first] = piece.copies[t.second];
+    }
+    accepting = piece.dfa->start->isAccepting;
+    return true;
+}
+
+bool CountingConstruction::entry(size_t j, Transitions &out,
+                                 bool &accepting) {
+    const Counted &c = counted[j];
+    out.clear();
+    accepting = false;
+    if (c.min == 0 && !continuation(j + 1, out, accepting)) {
+        return false;
+    }
+    return merge(out, loopTransitions(c));
+}
+
+CountingConstruction::Transitions
+CountingConstruction::loopTransitions(const Counted &c) {
+    Transitions loop;
+    for (int ch = 1; ch < 256; ch++) {
+        if (c.chars.test(ch)) {
+            loop[static_cast<char>(ch)] = c.loop;
+        }
+    }
+    return loop;
+}
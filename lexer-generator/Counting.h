@@ -0,0 +1,74 @@
+#pragma once
+#include "DFA.h"
+#include "RegexAST.h"
+#include <bitset>
+#include <map>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+// 计数自动机构造：把大次数的单字符重复 c{m,n} 表示为一个带计数器的状态，
+// 而不是展开成 n 个DFA状态，例如 [0-9]{1,1000} 只需要 2 个状态
+//   - 规则按顶层连接拆成 P0 C1 P1 ... Ck Pk，Cj 是字符集合 Sj 上的计数重复，
+//     Pj 用导数构造并最小化后按原样拼接
+//   - 计数状态 Lj 在 Sj 上自环，计数器记录自环次数；离开 Lj 或在 Lj 接受时
+//     要求次数不少于 mj，达到 nj 后不再自环
+//   - 为保证每个时刻只有一个计数器有效，要求拼接结果是确定的（Sj 与其后
+//     可能的首字符不相交），且 P1 ... P(k-1) 不匹配空串、是无前缀的（接受
+//     状态没有出边）
+// 条件不满足时 build 返回 nullptr，调用方应改用普通构造展开重复
+class CountingConstruction {
+  public:
+    // threshold：上限（无上限时为下限）不小于该值的重复才用计数器表示
+    explicit CountingConstruction(int threshold = 16);
+
+    shared_ptr<DFA> build(shared_ptr<ASTNode> ast);
+
+  private:
+    typedef map<char, shared_ptr<DFAState>> Transitions;
+
+    // 一段普通子表达式 Pj 的DFA及其在结果中的副本
+    struct Piece {
+        vector<shared_ptr<ASTNode>> factors; // 为空表示空串
+        shared_ptr<DFA> dfa;
+        bool empty; // 只匹配空串
+        map<shared_ptr<DFAState>, shared_ptr<DFAState>> copies;
+    };
+
+    // 计数重复 Cj = Sj{min,max}
+    struct Counted {
+        bitset<256> chars;
+        int min;
+        int max;
+        shared_ptr<DFAState> loop; // 计数状态 Lj
+    };
+
+    int threshold;
+    int nextId;
+    vector<Piece> pieces;     // P0 ... Pk
+    vector<Counted> counted;  // C1 ... Ck（下标 j - 1）
+    vector<shared_ptr<DFAState>> begins; // 读 Cj 之前的状态（下标 j - 1）
+
+    // 把顶层连接展开为因子列表
+    static void flatten(shared_ptr<ASTNode> node,
+                        vector<shared_ptr<ASTNode>> &factors);
+
+    // 单字符节点匹配的字符集合；不是单字符节点时返回 false
+    static bool charClass(shared_ptr<ASTNode> node, bitset<256> &chars);
+
+    shared_ptr<DFAState> newState();
+
+    // 将 from 并入 into，同一字符指向不同状态（不确定）时返回 false
+    static bool merge(Transitions &into, const Transitions &from);
+
+    // 计数状态在自身字符集合上的自环
+    static Transitions loopTransitions(const Counted &c);
+
+    // 读 pieces[j] counted[j] ... 时第一步的转换和是否可以立即接受；
+    // 拼接后不确定时返回 false
+    bool continuation(size_t j, Transitions &out, bool &accepting);
+
+    // 读 counted[j] pieces[j + 1] ... 时第一步的转换和是否可以立即接受
+    bool entry(size_t j, Transitions &out, bool &accepting);
+};
@@ -4,6 +4,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <vector>
 
 using namespace std;
 
@@ -32,12 +33,22 @@ class DFAState {
     }
 };
 
+// 计数状态的重复次数范围
+struct CounterRange {
+    int min; // 离开计数状态或在此接受前至少要走过的自环次数（含进入的一步）
+    int max; // 最多次数，-1 表示无上限
+};
+
 // 确定有限自动机
 class DFA {
   public:
     shared_ptr<DFAState> start;       // 起始状态
     set<shared_ptr<DFAState>> states; // 所有状态的集合
 
+    // 计数自动机（见 Counting.h）：计数状态带一个计数器，记录连续停留在该
+    // 状态的步数。普通DFA为空；带计数状态的DFA不能交给 DFAMinimizer
+    map<shared_ptr<DFAState>, CounterRange> counters;
+
     DFA(shared_ptr<DFAState> s) : start(s) { states.insert(s); }
 
     // 添加状态
@@ -46,12 +57,82 @@ class DFA {
     // 匹配字符串
     bool match(const string &input) {
         auto current = start;
+        int count = 0;
         for (char ch : input) {
             if (!current->hasTransition(ch)) {
                 return false;
             }
-            current = current->transitions[ch];
+            auto next = current->transitions[ch];
+            auto counter = counters.find(current);
+            if (next != current) {
+                if (counter != counters.end() && count < counter->second.min) {
+                    return false;
+                }
+                count = 1;
+            } else if (counter != counters.end()) {
+                if (count == counter->second.max) {
+                    return false;
+                }
+                count++;
+            }
+            current = next;
+        }
+        auto counter = counters.find(current);
+        return current->isAccepting &&
+               (counter == counters.end() || count >= counter->second.min);
+    }
+};
+
+// 扁平化的DFA：状态按从起始状态出发的BFS顺序编号（起始状态为0），
+// 转换存放在 transitions[state * 256 + byte] 中，便于运行时解释执行或JIT编译
+struct FlatDFA {
+    int stateCount = 0;
+    vector<int> transitions; // -1表示无转换
+    vector<bool> accepting;
+
+    static FlatDFA fromDFA(const shared_ptr<DFA> &dfa) {
+        FlatDFA flat;
+        vector<shared_ptr<DFAState>> order;
+        map<shared_ptr<DFAState>, int> ids;
+        order.push_back(dfa->start);
+        ids[dfa->start] = 0;
+        for (size_t k = 0; k < order.size(); k++) {
+            for (int b = 0; b < 256; b++) {
+                auto it = order[k]->transitions.find(static_cast<char>(b));
+                if (it != order[k]->transitions.end() &&
+                    ids.find(it->second) == ids.end()) {
+                    ids[it->second] = static_cast<int>(order.size());
+                    order.push_back(it->second);
+                }
+            }
+        }
+
+        flat.stateCount = static_cast<int>(order.size());
+        flat.transitions.assign(order.size() * 256, -1);
+        for (size_t k = 0; k < order.size(); k++) {
+            flat.accepting.push_back(order[k]->isAccepting);
+            for (const auto &t : order[k]->transitions) {
+                unsigned char b = static_cast<unsigned char>(t.first);
+                flat.transitions[k * 256 + b] = ids[t.second];
+            }
+        }
+        return flat;
+    }
+
+    // 从 begin 开始做最长匹配，返回匹配长度（0表示不匹配）
+    int match(const unsigned char *begin, const unsigned char *end) const {
+        int state = 0;
+        int lastAccepting = 0;
+        for (const unsigned char *p = begin; p < end; p++) {
+            int next = transitions[state * 256 + *p];
+            if (next == -1) {
+                break;
+            }
+            state = next;
+            if (accepting[state]) {
+                lastAccepting = static_cast<int>(p + 1 - begin);
+            }
         }
-        return current->isAccepting;
+        return lastAccepting;
     }
 };
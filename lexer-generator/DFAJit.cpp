@@ -0,0 +1,211 @@
+#include "DFAJit.h"
+#include <cstring>
+
+#if DFA_JIT_AVAILABLE
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// 出边区间不超过该数目的状态用比较树分派（树深不超过4），否则用跳转表
+static const size_t MAX_COMPARE_RANGES = 16;
+
+DFAJit::~DFAJit() {
+#if DFA_JIT_AVAILABLE
+    if (memory) {
+        munmap(memory, memorySize);
+    }
+#endif
+}
+
+int DFAJit::newLabel() {
+    labels.push_back(-1);
+    return static_cast<int>(labels.size()) - 1;
+}
+
+void DFAJit::bindLabel(int label) {
+    labels[label] = static_cast<long>(code.size());
+}
+
+void DFAJit::emit(initializer_list<uint8_t> bytes) {
+    code.insert(code.end(), bytes.begin(), bytes.end());
+}
+
+void DFAJit::emitInt32(int32_t value) {
+    for (int i = 0; i < 4; i++) {
+        code.push_back(
+            static_cast<uint8_t>(static_cast<uint32_t>(value) >> (8 * i)));
+    }
+}
+
+void DFAJit::emitJump(int label) {
+    emit({0xE9});
+    fixups.push_back({code.size(), label, FixupKind::REL32, 0});
+    emitInt32(0);
+}
+
+void DFAJit::emitJcc(uint8_t condition, int label) {
+    emit({0x0F, condition});
+    fixups.push_back({code.size(), label, FixupKind::REL32, 0});
+    emitInt32(0);
+}
+
+void DFAJit::emitCompareTree(const vector<ByteRange> &ranges, int l, int r,
+                             const vector<int> &stateLabels) {
+    if (l == r) {
+        if (ranges[l].target == -1) {
+            emit({0xC3}); // ret
+        } else {
+            emitJump(stateLabels[ranges[l].target]);
+        }
+        return;
+    }
+
+    // cmp ecx, lo; jb 左半部分；否则落入右半部分
+    int m = (l + r + 1) / 2;
+    int left = newLabel();
+    emit({0x81, 0xF9});
+    emitInt32(ranges[m].lo);
+    emitJcc(0x82, left);
+    emitCompareTree(ranges, m, r, stateLabels);
+    bindLabel(left);
+    emitCompareTree(ranges, l, m - 1, stateLabels);
+}
+
+// 寄存器约定（System V）：rdi = 当前位置，rsi = 输入末尾，
+// rdx = 匹配起点，rax = 最后一次到达接受状态时的匹配长度，ecx = 当前字节
+size_t DFAJit::compileDFA(const FlatDFA &dfa) {
+    size_t entry = code.size();
+    emit({0x48, 0x89, 0xFA}); // mov rdx, rdi
+    emit({0x31, 0xC0});       // xor eax, eax
+
+    vector<int> stateLabels;
+    for (int s = 0; s < dfa.stateCount; s++) {
+        stateLabels.push_back(newLabel());
+    }
+    int failLabel = newLabel();
+
+    for (int s = 0; s < dfa.stateCount; s++) {
+        bindLabel(stateLabels[s]);
+        if (dfa.accepting[s]) {
+            emit({0x48, 0x89, 0xF8}); // mov rax, rdi
+            emit({0x48, 0x29, 0xD0}); // sub rax, rdx
+        }
+
+        // 把转换行按目标状态合并为连续的字节区间
+        vector<ByteRange> ranges;
+        bool hasTransition = false;
+        for (int b = 0; b < 256; b++) {
+            int target = dfa.transitions[s * 256 + b];
+            hasTransition = hasTransition || target != -1;
+            if (!ranges.empty() && ranges.back().target == target) {
+                ranges.back().hi = b;
+            } else {
+                ranges.push_back({b, b, target});
+            }
+        }
+        if (!hasTransition) {
+            emit({0xC3}); // ret：没有出边的状态直接返回
+            continue;
+        }
+
+        emit({0x48, 0x39, 0xF7});       // cmp rdi, rsi
+        emitJcc(0x83, failLabel);       // jae fail
+        emit({0x0F, 0xB6, 0x0F});       // movzx ecx, byte [rdi]
+        emit({0x48, 0x83, 0xC7, 0x01}); // add rdi, 1
+
+        if (ranges.size() <= MAX_COMPARE_RANGES) {
+            emitCompareTree(ranges, 0, static_cast<int>(ranges.size()) - 1,
+                            stateLabels);
+        } else {
+            // 跳转表：表项为目标代码相对表起点的偏移
+            int table = newLabel();
+            vector<int> targets;
+            for (int b = 0; b < 256; b++) {
+                int target = dfa.transitions[s * 256 + b];
+                targets.push_back(target == -1 ? failLabel
+                                               : stateLabels[target]);
+            }
+            jumpTables.push_back({table, targets});
+            emit({0x4C, 0x8D, 0x05}); // lea r8, [rip + table]
+            fixups.push_back({code.size(), table, FixupKind::REL32, 0});
+            emitInt32(0);
+            emit({0x4D, 0x63, 0x0C, 0x88}); // movsxd r9, dword [r8 + rcx * 4]
+            emit({0x4D, 0x01, 0xC1});       // add r9, r8
+            emit({0x41, 0xFF, 0xE1});       // jmp r9
+        }
+    }
+
+    bindLabel(failLabel);
+    emit({0xC3}); // ret
+    return entry;
+}
+
+bool DFAJit::compile(const vector<FlatDFA> &dfas) {
+#if DFA_JIT_AVAILABLE
+    if (memory) {
+        munmap(memory, memorySize);
+        memory = nullptr;
+        memorySize = 0;
+    }
+    code.clear();
+    labels.clear();
+    fixups.clear();
+    jumpTables.clear();
+    functions.clear();
+
+    vector<size_t> entries;
+    for (const FlatDFA &dfa : dfas) {
+        entries.push_back(compileDFA(dfa));
+    }
+
+    // 跳转表放在所有函数之后，按4字节对齐
+    while (code.size() % 4 != 0) {
+        emit({0xCC}); // int3
+    }
+    for (const auto &table : jumpTables) {
+        bindLabel(table.first);
+        size_t base = code.size();
+        for (int target : table.second) {
+            fixups.push_back({code.size(), target, FixupKind::TABLE, base});
+            emitInt32(0);
+        }
+    }
+
+    // 回填所有跳转偏移
+    for (const Fixup &fixup : fixups) {
+        long target = labels[fixup.label];
+        long origin = fixup.kind == FixupKind::REL32
+                          ? static_cast<long>(fixup.pos) + 4
+                          : static_cast<long>(fixup.base);
+        int32_t offset = static_cast<int32_t>(target - origin);
+        memcpy(&code[fixup.pos], &offset, 4);
+    }
+
+    // 先以可写方式映射并拷贝代码，再改为只读可执行（不同时可写可执行）
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t size = (code.size() + pageSize - 1) / pageSize * pageSize;
+    void *page = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (page == MAP_FAILED) {
+        return false;
+    }
+    memcpy(page, code.data(), code.size());
+    if (mprotect(page, size, PROT_READ | PROT_EXEC) != 0) {
+        munmap(page, size);
+        return false;
+    }
+    memory = page;
+    memorySize = size;
+
+    for (size_t entry : entries) {
+        functions.push_back(reinterpret_cast<MatchFunction>(
+            static_cast<uint8_t *>(memory) + entry));
+    }
+    return true;
+#else
+    (void)dfas;
+    return false;
+#endif
+}
@@ -0,0 +1,84 @@
+#pragma once
+#include "DFA.h"
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// 仅在 x86-64 System V 平台（Linux、macOS 等）上启用 JIT
+#if defined(__x86_64__) && !defined(_WIN32)
+#define DFA_JIT_AVAILABLE 1
+#else
+#define DFA_JIT_AVAILABLE 0
+#endif
+
+// DFA的JIT编译器：把扁平化的DFA翻译成 x86-64 机器码，放入 mmap 分配的可执行页。
+// 每个状态是一段代码，状态之间直接跳转；出边区间少的状态用比较树分派，
+// 区间多的状态用256项跳转表分派。
+// 生成函数的语义与 FlatDFA::match 相同：返回最长匹配长度，0表示不匹配。
+class DFAJit {
+  public:
+    typedef int (*MatchFunction)(const unsigned char *begin,
+                                 const unsigned char *end);
+
+    DFAJit() : memory(nullptr), memorySize(0) {}
+    ~DFAJit();
+
+    DFAJit(const DFAJit &) = delete;
+    DFAJit &operator=(const DFAJit &) = delete;
+
+    // 当前平台是否支持JIT
+    static bool isSupported() { return DFA_JIT_AVAILABLE != 0; }
+
+    // 把所有DFA编译进同一块可执行内存，不支持的平台或分配失败时返回false
+    bool compile(const vector<FlatDFA> &dfas);
+
+    // 第 i 个DFA的匹配函数（compile 成功后才有效）
+    MatchFunction function(size_t i) const { return functions[i]; }
+
+    // 生成的机器码（含跳转表）字节数
+    size_t getCodeSize() const { return code.size(); }
+
+  private:
+    // 跳转位置回填：kind 为 REL32 时写入相对 (pos + 4) 的偏移，
+    // 为 TABLE 时写入相对跳转表起点 base 的偏移
+    enum class FixupKind { REL32, TABLE };
+    struct Fixup {
+        size_t pos;
+        int label;
+        FixupKind kind;
+        size_t base;
+    };
+
+    // 字节区间 [lo, hi] 上的转换，target 为目标状态标签（-1表示失败返回）
+    struct ByteRange {
+        int lo;
+        int hi;
+        int target;
+    };
+
+    vector<uint8_t> code;
+    vector<long> labels; // 标签 -> 代码偏移（-1表示尚未绑定）
+    vector<Fixup> fixups;
+    vector<pair<int, vector<int>>> jumpTables; // 跳转表标签 -> 256个目标标签
+    vector<MatchFunction> functions;
+    void *memory;
+    size_t memorySize;
+
+    int newLabel();
+    void bindLabel(int label);
+    void emit(initializer_list<uint8_t> bytes);
+    void emitInt32(int32_t value);
+    void emitJump(int label);                   // jmp rel32
+    void emitJcc(uint8_t condition, int label); // jcc rel32（0F 8x）
+
+    // 编译一个DFA，返回函数入口偏移
+    size_t compileDFA(const FlatDFA &dfa);
+
+    // 用比较树在 ranges[l..r] 中分派，ecx 保证落在这些区间内
+    void emitCompareTree(const vector<ByteRange> &ranges, int l, int r,
+                         const vector<int> &stateLabels);
+};
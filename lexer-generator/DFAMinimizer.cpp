@@ -1,6 +1,6 @@
 #include "DFAMinimizer.h"
+#include <algorithm>
 #include <map>
-#include <string>
 
 using namespace std;
 
@@ -9,170 +9,194 @@ shared_ptr<DFA> DFAMinimizer::minimize(shared_ptr<DFA> dfa) {
         return dfa;
     }
 
-    // 收集字母表
-    set<char> alphabet = collectAlphabet(dfa);
+    // 只有一个状态时不需要最小化；全部是接受状态（或全部不是）时仍要按转换细化
+    if (dfa->states.size() <= 1) {
+        return dfa;
+    }
 
-    // 初始划分：接受状态和非接受状态
-    vector<set<shared_ptr<DFAState>>> partitions;
-    set<shared_ptr<DFAState>> acceptingStates;
-    set<shared_ptr<DFAState>> nonAcceptingStates;
-
-    for (auto state : dfa->states) {
-        if (state->isAccepting) {
-            acceptingStates.insert(state);
-        } else {
-            nonAcceptingStates.insert(state);
+    // 状态按编号排列，使划分和结果与指针地址无关
+    vector<shared_ptr<DFAState>> states(dfa->states.begin(), dfa->states.end());
+    stable_sort(states.begin(), states.end(),
+                [](const shared_ptr<DFAState> &a,
+                   const shared_ptr<DFAState> &b) { return a->id < b->id; });
+    map<shared_ptr<DFAState>, int> index;
+    for (size_t i = 0; i < states.size(); i++) {
+        index[states[i]] = static_cast<int>(i);
+    }
+    int n = static_cast<int>(states.size());
+
+    // 反向转换：predecessors[t] 为 (字符, 前驱) 列表
+    vector<vector<pair<unsigned char, int>>> predecessors(n);
+    for (int s = 0; s < n; s++) {
+        for (auto &pair : states[s]->transitions) {
+            predecessors[index[pair.second]].push_back(
+                make_pair(static_cast<unsigned char>(pair.first), s));
         }
     }
 
-    if (!acceptingStates.empty()) {
-        partitions.push_back(acceptingStates);
-    }
-    if (!nonAcceptingStates.empty()) {
-        partitions.push_back(nonAcceptingStates);
+    // 初始划分：接受状态和非接受状态
+    Partition partition;
+    partition.blockOf.assign(n, 0);
+    partition.position.assign(n, 0);
+    for (int accepting = 1; accepting >= 0; accepting--) {
+        int begin = static_cast<int>(partition.elements.size());
+        for (int s = 0; s < n; s++) {
+            if (states[s]->isAccepting == (accepting == 1)) {
+                partition.position[s] =
+                    static_cast<int>(partition.elements.size());
+                partition.blockOf[s] = static_cast<int>(partition.first.size());
+                partition.elements.push_back(s);
+            }
+        }
+        if (static_cast<int>(partition.elements.size()) > begin) {
+            partition.first.push_back(begin);
+            partition.end.push_back(
+                static_cast<int>(partition.elements.size()));
+            partition.marked.push_back(0);
+        }
     }
 
-    // 如果只有一个划分，不需要最小化
-    if (partitions.size() <= 1) {
-        return dfa;
+    // 待处理的分割者。缺少的转换指向的隐含状态自成一块且永不分裂，按
+    // Hopcroft算法只需处理除一个块以外的所有块，因此不必把它作为分割者
+    vector<int> work;
+    vector<bool> inWork;
+    for (size_t b = 0; b < partition.first.size(); b++) {
+        work.push_back(static_cast<int>(b));
+        inWork.push_back(true);
     }
 
-    // 不断细化划分直到不再变化
-    bool changed = true;
-    while (changed) {
-        changed = false;
-        vector<set<shared_ptr<DFAState>>> newPartitions;
-
-        for (const auto &partition : partitions) {
-            if (partition.size() == 1) {
-                // 单个状态不需要细化
-                newPartitions.push_back(partition);
-                continue;
+    vector<vector<int>> byChar(256); // 本轮各字符上的前驱
+    vector<int> usedChars;
+    while (!work.empty()) {
+        int splitter = work.back();
+        work.pop_back();
+        inWork[splitter] = false;
+
+        // 按字符收集指向分割者的前驱（先复制分割者的成员，分裂会移动它们）
+        vector<int> members(
+            partition.elements.begin() + partition.first[splitter],
+            partition.elements.begin() + partition.end[splitter]);
+        for (int t : members) {
+            for (const auto &edge : predecessors[t]) {
+                if (byChar[edge.first].empty()) {
+                    usedChars.push_back(edge.first);
+                }
+                byChar[edge.first].push_back(edge.second);
             }
+        }
 
-            // 尝试细化这个划分
-            vector<set<shared_ptr<DFAState>>> refined =
-                refinePartition(partition, partitions, alphabet);
-            if (refined.size() > 1) {
-                changed = true;
-                newPartitions.insert(newPartitions.end(), refined.begin(),
-                                     refined.end());
-            } else {
-                newPartitions.push_back(partition);
+        for (int c : usedChars) {
+            vector<int> touched;
+            for (int s : byChar[c]) {
+                mark(partition, s, touched);
+            }
+            byChar[c].clear();
+
+            for (const auto &halves : split(partition, touched)) {
+                int oldBlock = halves.first;
+                int newBlock = halves.second;
+                inWork.push_back(false);
+                int oldSize =
+                    partition.end[oldBlock] - partition.first[oldBlock];
+                int newSize =
+                    partition.end[newBlock] - partition.first[newBlock];
+                if (inWork[oldBlock] || newSize <= oldSize) {
+                    work.push_back(newBlock);
+                    inWork[newBlock] = true;
+                } else {
+                    work.push_back(oldBlock);
+                    inWork[oldBlock] = true;
+                }
             }
         }
-
-        partitions = newPartitions;
+        usedChars.clear();
     }
 
     // 构建最小化后的DFA
-    return buildMinimizedDFA(dfa, partitions);
+    return buildMinimizedDFA(dfa, states, partition);
 }
 
-set<char> DFAMinimizer::collectAlphabet(shared_ptr<DFA> dfa) {
-    set<char> alphabet;
-
-    for (auto state : dfa->states) {
-        for (auto &pair : state->transitions) {
-            alphabet.insert(pair.first);
-        }
+void DFAMinimizer::mark(Partition &partition, int state,
+                        vector<int> &touched) {
+    int block = partition.blockOf[state];
+    int boundary = partition.first[block] + partition.marked[block];
+    int pos = partition.position[state];
+    if (pos < boundary) {
+        return; // 已标记
     }
-
-    return alphabet;
+    if (partition.marked[block] == 0) {
+        touched.push_back(block);
+    }
+    // 与第一个未标记的状态交换位置
+    int other = partition.elements[boundary];
+    partition.elements[boundary] = state;
+    partition.elements[pos] = other;
+    partition.position[state] = boundary;
+    partition.position[other] = pos;
+    partition.marked[block]++;
 }
 
-vector<set<shared_ptr<DFAState>>> DFAMinimizer::refinePartition(
-    const set<shared_ptr<DFAState>> &partition,
-    const vector<set<shared_ptr<DFAState>>> &allPartitions,
-    const set<char> &alphabet) {
-
-    // 为每个状态计算"签名"（根据转换到哪个划分）
-    map<string, set<shared_ptr<DFAState>>> groups;
-
-    for (auto state : partition) {
-        // 构建状态的签名：对于每个字符，转换到哪个划分
-        string signature;
-        for (char c : alphabet) {
-            if (state->hasTransition(c)) {
-                auto targetState = state->transitions[c];
-                // 找到targetState属于哪个划分
-                int partitionIndex = -1;
-                for (int i = 0; i < static_cast<int>(allPartitions.size());
-                     i++) {
-                    if (allPartitions[i].find(targetState) !=
-                        allPartitions[i].end()) {
-                        partitionIndex = i;
-                        break;
-                    }
-                }
-                signature += to_string(partitionIndex) + ",";
-            } else {
-                signature += "-1,"; // 没有转换
-            }
+vector<pair<int, int>> DFAMinimizer::split(Partition &partition,
+                                           const vector<int> &touched) {
+    vector<pair<int, int>> result;
+    for (int block : touched) {
+        int marked = partition.marked[block];
+        partition.marked[block] = 0;
+        if (marked == partition.end[block] - partition.first[block]) {
+            continue; // 整块都被标记，不需要分裂
         }
-
-        groups[signature].insert(state);
-    }
-
-    // 将分组转换为vector
-    vector<set<shared_ptr<DFAState>>> result;
-    for (auto &pair : groups) {
-        result.push_back(pair.second);
+        // 标记的部分成为新块
+        int newBlock = static_cast<int>(partition.first.size());
+        partition.first.push_back(partition.first[block]);
+        partition.end.push_back(partition.first[block] + marked);
+        partition.marked.push_back(0);
+        partition.first[block] += marked;
+        for (int i = partition.first[newBlock]; i < partition.end[newBlock];
+             i++) {
+            partition.blockOf[partition.elements[i]] = newBlock;
+        }
+        result.push_back(make_pair(block, newBlock));
     }
-
     return result;
 }
 
-shared_ptr<DFA> DFAMinimizer::buildMinimizedDFA(
-    shared_ptr<DFA> originalDFA,
-    const vector<set<shared_ptr<DFAState>>> &partitions) {
+shared_ptr<DFA>
+DFAMinimizer::buildMinimizedDFA(shared_ptr<DFA> originalDFA,
+                                const vector<shared_ptr<DFAState>> &states,
+                                const Partition &partition) {
+    // 为每个块创建新的DFA状态，块按其第一个状态的编号排列
+    int blockCount = static_cast<int>(partition.first.size());
+    vector<int> newIds(blockCount, -1);
+    vector<shared_ptr<DFAState>> newStates;
+    vector<int> representatives;
+    for (size_t s = 0; s < states.size(); s++) {
+        int block = partition.blockOf[s];
+        if (newIds[block] == -1) {
+            newIds[block] = static_cast<int>(newStates.size());
+            auto newState = make_shared<DFAState>(newIds[block]);
+            newState->isAccepting = states[s]->isAccepting;
+            newStates.push_back(newState);
+            representatives.push_back(static_cast<int>(s));
+        }
+    }
 
-    // 为每个划分创建新的DFA状态
     map<shared_ptr<DFAState>, shared_ptr<DFAState>>
         stateMap; // 原状态 -> 新状态
-    map<set<shared_ptr<DFAState>>, shared_ptr<DFAState>>
-        partitionMap; // 划分 -> 新状态
-
-    int newStateId = 0;
-
-    // 创建新状态
-    for (const auto &partition : partitions) {
-        // 选择代表状态（通常是第一个）
-        shared_ptr<DFAState> representative = *partition.begin();
-        auto newState = make_shared<DFAState>(newStateId++);
-        newState->isAccepting = representative->isAccepting;
-
-        partitionMap[partition] = newState;
-
-        // 建立原状态到新状态的映射
-        for (auto oldState : partition) {
-            stateMap[oldState] = newState;
-        }
+    for (size_t s = 0; s < states.size(); s++) {
+        stateMap[states[s]] = newStates[newIds[partition.blockOf[s]]];
     }
 
-    // 构建转换
-    for (const auto &partition : partitions) {
-        auto newState = partitionMap[partition];
-        auto representative = *partition.begin();
-
-        // 复制代表状态的转换，但指向新的目标状态
-        for (auto &pair : representative->transitions) {
-            char c = pair.first;
-            auto oldTarget = pair.second;
-            auto newTarget = stateMap[oldTarget];
-            newState->addTransition(c, newTarget);
+    // 复制代表状态的转换，但指向新的目标状态
+    for (size_t i = 0; i < newStates.size(); i++) {
+        for (auto &pair : states[representatives[i]]->transitions) {
+            newStates[i]->addTransition(pair.first, stateMap[pair.second]);
         }
     }
 
-    // 找到新的起始状态
-    auto newStart = stateMap[originalDFA->start];
-
     // 创建新的DFA
-    auto minimizedDFA = make_shared<DFA>(newStart);
-
-    // 添加所有新状态
-    for (const auto &pair : partitionMap) {
-        minimizedDFA->addState(pair.second);
+    auto minimizedDFA = make_shared<DFA>(stateMap[originalDFA->start]);
+    for (auto state : newStates) {
+        minimizedDFA->addState(state);
     }
 
     return minimizedDFA;
@@ -1,29 +1,42 @@
 #pragma once
 #include "DFA.h"
 #include <memory>
-#include <set>
 #include <vector>
 
 using namespace std;
 
 // DFA最小化算法：合并等价状态
+// 使用Hopcroft算法：从“接受/非接受”划分出发，每次取出一个块作为分割者，
+// 按各字符上指向该块的前驱集合分裂其他块；一个块分裂后只需把较小的一半
+// 加入待处理队列，总时间为 O(k·n·log n)，数十万个状态的DFA（如数万个关键字
+// 构成的字典树）也能快速最小化。缺少的转换视为指向一个单独的隐含状态，
+// 因此结果与逐轮按签名细化的做法完全相同
 class DFAMinimizer {
   public:
     // 最小化DFA
     shared_ptr<DFA> minimize(shared_ptr<DFA> dfa);
 
   private:
-    // 收集DFA中所有可能的输入字符
-    set<char> collectAlphabet(shared_ptr<DFA> dfa);
+    // 可细化的划分：同一块的状态在 elements 中连续存放
+    struct Partition {
+        vector<int> elements; // 按块排列的状态编号
+        vector<int> position; // 状态在 elements 中的位置
+        vector<int> blockOf;  // 状态所在的块
+        vector<int> first;    // 块在 elements 中的范围 [first, end)
+        vector<int> end;
+        vector<int> marked; // 块中已标记的状态数（标记的状态排在块的开头）
+    };
 
-    // 细化划分：根据字符转换将划分进一步分割
-    vector<set<shared_ptr<DFAState>>>
-    refinePartition(const set<shared_ptr<DFAState>> &partition,
-                    const vector<set<shared_ptr<DFAState>>> &allPartitions,
-                    const set<char> &alphabet);
+    // 标记一个状态，第一次标记某个块时把它记入 touched
+    static void mark(Partition &partition, int state, vector<int> &touched);
+
+    // 按标记分裂 touched 中的块，返回新块的编号（与原块对应）
+    static vector<pair<int, int>> split(Partition &partition,
+                                        const vector<int> &touched);
 
     // 构建最小化后的DFA
     shared_ptr<DFA>
     buildMinimizedDFA(shared_ptr<DFA> originalDFA,
-                      const vector<set<shared_ptr<DFAState>>> &partitions);
+                      const vector<shared_ptr<DFAState>> &states,
+                      const Partition &partition);
 };
@@ -0,0 +1,521 @@
+#include "Derivative.h"
+#include <algorithm>
+#include <map>
+#include <queue>
+#include <stdexcept>
+
+using namespace std;
+
+// 字母表：NFA用 '\0' 表示epsilon，其余各条构造路径都不会产生 '\0' 上的转换，
+// 这里保持一致，补运算也只相对于 1-255 的字符串
+static bitset<256> alphabet() {
+    bitset<256> sigma;
+    sigma.set();
+    sigma.reset(0);
+    return sigma;
+}
+
+DerivativeConstruction::DerivativeConstruction() {
+    emptyTerm = intern(Term{TermKind::EMPTY, bitset<256>(), {}, false, 0, 0});
+    epsilonTerm =
+        intern(Term{TermKind::EPSILON, bitset<256>(), {}, true, 0, 0});
+    universeTerm = makeNot(emptyTerm);
+}
+
+shared_ptr<DFA> DerivativeConstruction::build(shared_ptr<ASTNode> ast) {
+    if (!ast) {
+        throw runtime_error("AST节点为空");
+    }
+
+    // 1. 从起始项出发按BFS求导，每个不同的项是一个状态
+    int startTerm = fromAST(ast);
+    vector<int> stateTerms;
+    map<int, int> stateIndex; // 项编号 -> 状态下标
+    vector<vector<pair<bitset<256>, int>>> edges; // 状态 -> (字符类, 目标)
+    stateTerms.push_back(startTerm);
+    stateIndex[startTerm] = 0;
+    for (size_t i = 0; i < stateTerms.size(); i++) {
+        int term = stateTerms[i];
+        vector<pair<bitset<256>, int>> out;
+        // derivativeClasses 返回的引用在求导时可能失效，这里复制一份
+        vector<bitset<256>> classes = derivativeClasses(term);
+        for (const auto &chars : classes) {
+            int ch = 1;
+            while (!chars.test(ch)) {
+                ch++;
+            }
+            int target = derivative(term, static_cast<unsigned char>(ch));
+            if (target == emptyTerm) {
+                continue;
+            }
+            if (stateIndex.find(target) == stateIndex.end()) {
+                stateIndex[target] = static_cast<int>(stateTerms.size());
+                stateTerms.push_back(target);
+            }
+            out.push_back(make_pair(chars, stateIndex[target]));
+        }
+        edges.push_back(out);
+    }
+
+    // 2. 去掉无法到达接受状态的死状态（如 a&~a 求导后得到的 ε&~ε）
+    size_t count = stateTerms.size();
+    vector<vector<int>> reverseEdges(count);
+    for (size_t i = 0; i < count; i++) {
+        for (const auto &edge : edges[i]) {
+            reverseEdges[edge.second].push_back(static_cast<int>(i));
+        }
+    }
+    vector<bool> live(count, false);
+    queue<int> worklist;
+    for (size_t i = 0; i < count; i++) {
+        if (terms[stateTerms[i]].nullable) {
+            live[i] = true;
+            worklist.push(static_cast<int>(i));
+        }
+    }
+    while (!worklist.empty()) {
+        int state = worklist.front();
+        worklist.pop();
+        for (int source : reverseEdges[state]) {
+            if (!live[source]) {
+                live[source] = true;
+                worklist.push(source);
+            }
+        }
+    }
+
+    // 3. 构造DFA，状态编号按BFS顺序
+    vector<shared_ptr<DFAState>> states(count);
+    int dfaStateId = 0;
+    for (size_t i = 0; i < count; i++) {
+        if (live[i] || i == 0) {
+            states[i] = make_shared<DFAState>(dfaStateId++);
+            states[i]->isAccepting = terms[stateTerms[i]].nullable;
+        }
+    }
+    auto dfa = make_shared<DFA>(states[0]);
+    for (size_t i = 0; i < count; i++) {
+        if (!states[i]) {
+            continue;
+        }
+        dfa->addState(states[i]);
+        for (const auto &edge : edges[i]) {
+            if (!live[edge.second]) {
+                continue;
+            }
+            for (int ch = 1; ch < 256; ch++) {
+                if (edge.first.test(ch)) {
+                    states[i]->addTransition(static_cast<char>(ch),
+                                             states[edge.second]);
+                }
+            }
+        }
+    }
+
+    return dfa;
+}
+
+bool DerivativeConstruction::needsDerivatives(shared_ptr<ASTNode> ast) {
+    switch (ast->type) {
+    case NodeType::INTERSECT:
+    case NodeType::COMPLEMENT:
+        return true;
+    case NodeType::CONCAT:
+    case NodeType::UNION: {
+        const vector<shared_ptr<ASTNode>> &children =
+            ast->type == NodeType::CONCAT
+                ? dynamic_pointer_cast<ConcatNode>(ast)->children
+                : dynamic_pointer_cast<UnionNode>(ast)->children;
+        for (auto child : children) {
+            if (needsDerivatives(child)) {
+                return true;
+            }
+        }
+        return false;
+    }
+    case NodeType::STAR:
+        return needsDerivatives(dynamic_pointer_cast<StarNode>(ast)->child);
+    case NodeType::PLUS:
+        return needsDerivatives(dynamic_pointer_cast<PlusNode>(ast)->child);
+    case NodeType::REPEAT:
+        return needsDerivatives(dynamic_pointer_cast<RepeatNode>(ast)->child);
+    default:
+        return false;
+    }
+}
+
+int DerivativeConstruction::intern(const Term &term) {
+    // 项的结构编码为字符串作为哈希键
+    string key(1, static_cast<char>(term.kind));
+    if (term.kind == TermKind::CHARS) {
+        key += term.chars.to_string();
+    }
+    if (term.kind == TermKind::REPEAT) {
+        key += to_string(term.min) + ',' + to_string(term.max);
+    }
+    for (int child : term.children) {
+        key += ',';
+        key += to_string(child);
+    }
+
+    auto it = termTable.find(key);
+    if (it != termTable.end()) {
+        return it->second;
+    }
+    int id = static_cast<int>(terms.size());
+    terms.push_back(term);
+    termTable[key] = id;
+    return id;
+}
+
+int DerivativeConstruction::makeChars(const bitset<256> &chars) {
+    if (chars.none()) {
+        return emptyTerm;
+    }
+    return intern(Term{TermKind::CHARS, chars, {}, false, 0, 0});
+}
+
+int DerivativeConstruction::makeConcat(int left, int right) {
+    if (left == emptyTerm || right == emptyTerm) {
+        return emptyTerm; // ∅r = r∅ = ∅
+    }
+    if (left == epsilonTerm) {
+        return right; // εr = r
+    }
+    if (right == epsilonTerm) {
+        return left; // rε = r
+    }
+    if (terms[left].kind == TermKind::CONCAT) {
+        // 连接统一为右结合：(rs)t -> r(st)
+        int first = terms[left].children[0];
+        int rest = terms[left].children[1];
+        return makeConcat(first, makeConcat(rest, right));
+    }
+    bool nullable = terms[left].nullable && terms[right].nullable;
+    return intern(Term{TermKind::CONCAT, bitset<256>(), {left, right},
+                       nullable, 0, 0});
+}
+
+int DerivativeConstruction::makeStar(int child) {
+    if (child == emptyTerm || child == epsilonTerm) {
+        return epsilonTerm; // ∅* = ε* = ε
+    }
+    if (terms[child].kind == TermKind::STAR) {
+        return child; // (r*)* = r*
+    }
+    return intern(Term{TermKind::STAR, bitset<256>(), {child}, true, 0, 0});
+}
+
+int DerivativeConstruction::makeRepeat(int child, int min, int max) {
+    if (max == 0 || child == epsilonTerm) {
+        return epsilonTerm; // r{0} = ε{m,n} = ε
+    }
+    if (child == emptyTerm) {
+        return min == 0 ? epsilonTerm : emptyTerm;
+    }
+    if (terms[child].nullable) {
+        min = 0; // r 可空时 r{m,n} = r{0,n}
+    }
+    if (max == -1 && min <= 1) {
+        // r{0,} = r*，r{1,} = rr*
+        return min == 0 ? makeStar(child) : makeConcat(child, makeStar(child));
+    }
+    if (min == 1 && max == 1) {
+        return child;
+    }
+    return intern(
+        Term{TermKind::REPEAT, bitset<256>(), {child}, min == 0, min, max});
+}
+
+int DerivativeConstruction::makeOr(vector<int> children) {
+    // 展开嵌套的并，去掉 ∅，单字符项合并为一个字符集合
+    vector<int> flat;
+    bitset<256> chars;
+    for (size_t i = 0; i < children.size(); i++) {
+        const Term &term = terms[children[i]];
+        if (term.kind == TermKind::OR) {
+            children.insert(children.end(), term.children.begin(),
+                            term.children.end());
+        } else if (children[i] == universeTerm) {
+            return universeTerm; // r|~∅ = ~∅
+        } else if (term.kind == TermKind::CHARS) {
+            chars |= term.chars;
+        } else if (children[i] != emptyTerm) {
+            flat.push_back(children[i]);
+        }
+    }
+    if (chars.any()) {
+        flat.push_back(makeChars(chars));
+    }
+
+    sort(flat.begin(), flat.end());
+    flat.erase(unique(flat.begin(), flat.end()), flat.end());
+    if (flat.empty()) {
+        return emptyTerm;
+    }
+    if (flat.size() == 1) {
+        return flat[0];
+    }
+
+    bool nullable = false;
+    for (int child : flat) {
+        nullable = nullable || terms[child].nullable;
+    }
+    return intern(Term{TermKind::OR, bitset<256>(), flat, nullable, 0, 0});
+}
+
+int DerivativeConstruction::makeAnd(vector<int> children) {
+    // 展开嵌套的交，去掉 ~∅，单字符项合并为字符集合的交
+    vector<int> flat;
+    bitset<256> chars = alphabet();
+    bool hasChars = false;
+    for (size_t i = 0; i < children.size(); i++) {
+        const Term &term = terms[children[i]];
+        if (term.kind == TermKind::AND) {
+            children.insert(children.end(), term.children.begin(),
+                            term.children.end());
+        } else if (children[i] == emptyTerm) {
+            return emptyTerm; // r&∅ = ∅
+        } else if (term.kind == TermKind::CHARS) {
+            chars &= term.chars;
+            hasChars = true;
+        } else if (children[i] != universeTerm) {
+            flat.push_back(children[i]);
+        }
+    }
+    if (hasChars) {
+        if (chars.none()) {
+            return emptyTerm;
+        }
+        flat.push_back(makeChars(chars));
+    }
+
+    sort(flat.begin(), flat.end());
+    flat.erase(unique(flat.begin(), flat.end()), flat.end());
+    if (flat.empty()) {
+        return universeTerm;
+    }
+    if (flat.size() == 1) {
+        return flat[0];
+    }
+
+    bool nullable = true;
+    for (int child : flat) {
+        nullable = nullable && terms[child].nullable;
+    }
+    return intern(Term{TermKind::AND, bitset<256>(), flat, nullable, 0, 0});
+}
+
+int DerivativeConstruction::makeNot(int child) {
+    if (terms[child].kind == TermKind::NOT) {
+        return terms[child].children[0]; // ~~r = r
+    }
+    return intern(Term{TermKind::NOT, bitset<256>(), {child},
+                       !terms[child].nullable, 0, 0});
+}
+
+int DerivativeConstruction::fromAST(shared_ptr<ASTNode> node) {
+    switch (node->type) {
+    case NodeType::CHAR: {
+        bitset<256> chars;
+        chars.set(static_cast<unsigned char>(
+            dynamic_pointer_cast<CharNode>(node)->ch));
+        return fromCharSet(chars);
+    }
+    case NodeType::CHARSET: {
+        auto charset = dynamic_pointer_cast<CharsetNode>(node);
+        if (!charset->negated && charset->chars.empty()) {
+            return epsilonTerm; // 与Thompson构造一致：空字符类等价于空串
+        }
+        bitset<256> chars;
+        for (char ch : charset->chars) {
+            chars.set(static_cast<unsigned char>(ch));
+        }
+        if (charset->negated) {
+            chars.flip();
+            chars.reset('\n');
+            chars.reset(0);
+        }
+        return fromCharSet(chars);
+    }
+    case NodeType::ANY: {
+        bitset<256> chars;
+        chars.set();
+        chars.reset('\n');
+        chars.reset(0);
+        return fromCharSet(chars);
+    }
+    case NodeType::EPSILON:
+        return epsilonTerm;
+    case NodeType::CONCAT: {
+        auto concat = dynamic_pointer_cast<ConcatNode>(node);
+        vector<int> factors;
+        for (auto child : concat->children) {
+            factors.push_back(fromAST(child));
+        }
+        int term = factors.back();
+        for (size_t i = factors.size() - 1; i-- > 0;) {
+            term = makeConcat(factors[i], term);
+        }
+        return term;
+    }
+    case NodeType::UNION: {
+        vector<int> alternatives;
+        for (auto child : dynamic_pointer_cast<UnionNode>(node)->children) {
+            alternatives.push_back(fromAST(child));
+        }
+        return makeOr(alternatives);
+    }
+    case NodeType::STAR:
+        return makeStar(fromAST(dynamic_pointer_cast<StarNode>(node)->child));
+    case NodeType::PLUS: {
+        // r+ = rr*
+        int child = fromAST(dynamic_pointer_cast<PlusNode>(node)->child);
+        return makeConcat(child, makeStar(child));
+    }
+    case NodeType::REPEAT: {
+        auto repeat = dynamic_pointer_cast<RepeatNode>(node);
+        return makeRepeat(fromAST(repeat->child), repeat->min, repeat->max);
+    }
+    case NodeType::INTERSECT: {
+        auto intersect = dynamic_pointer_cast<IntersectNode>(node);
+        return makeAnd({fromAST(intersect->left), fromAST(intersect->right)});
+    }
+    case NodeType::COMPLEMENT:
+        return makeNot(
+            fromAST(dynamic_pointer_cast<ComplementNode>(node)->child));
+    default:
+        throw runtime_error("未知的AST节点类型");
+    }
+}
+
+int DerivativeConstruction::fromCharSet(bitset<256> chars) {
+    // 与Thompson构造一致：'\0' 表示epsilon，集合中的 '\0' 按空串处理
+    if (chars.test(0)) {
+        chars.reset(0);
+        return makeOr({makeChars(chars), epsilonTerm});
+    }
+    return makeChars(chars);
+}
+
+int DerivativeConstruction::derivative(int term, unsigned char ch) {
+    long long key = static_cast<long long>(term) * 256 + ch;
+    auto it = derivativeCache.find(key);
+    if (it != derivativeCache.end()) {
+        return it->second;
+    }
+
+    // terms 在构造新项时可能扩容，这里复制需要的字段
+    TermKind kind = terms[term].kind;
+    vector<int> children = terms[term].children;
+    int result = emptyTerm;
+    switch (kind) {
+    case TermKind::EMPTY:
+    case TermKind::EPSILON:
+        result = emptyTerm;
+        break;
+    case TermKind::CHARS:
+        result = terms[term].chars.test(ch) ? epsilonTerm : emptyTerm;
+        break;
+    case TermKind::CONCAT: {
+        // ∂(rs) = ∂r·s | (r可空时) ∂s
+        int left = makeConcat(derivative(children[0], ch), children[1]);
+        if (terms[children[0]].nullable) {
+            result = makeOr({left, derivative(children[1], ch)});
+        } else {
+            result = left;
+        }
+        break;
+    }
+    case TermKind::STAR:
+        // ∂(r*) = ∂r·r*
+        result = makeConcat(derivative(children[0], ch), term);
+        break;
+    case TermKind::REPEAT: {
+        // ∂(r{m,n}) = ∂r·r{m-1,n-1}
+        int min = max(terms[term].min - 1, 0);
+        int maxCount = terms[term].max == -1 ? -1 : terms[term].max - 1;
+        result = makeConcat(derivative(children[0], ch),
+                            makeRepeat(children[0], min, maxCount));
+        break;
+    }
+    case TermKind::OR:
+    case TermKind::AND: {
+        vector<int> parts;
+        for (int child : children) {
+            parts.push_back(derivative(child, ch));
+        }
+        result = kind == TermKind::OR ? makeOr(parts) : makeAnd(parts);
+        break;
+    }
+    case TermKind::NOT:
+        result = makeNot(derivative(children[0], ch));
+        break;
+    }
+
+    derivativeCache[key] = result;
+    return result;
+}
+
+const vector<bitset<256>> &DerivativeConstruction::derivativeClasses(int term) {
+    auto it = classCache.find(term);
+    if (it != classCache.end()) {
+        return it->second;
+    }
+
+    TermKind kind = terms[term].kind;
+    vector<int> children = terms[term].children;
+    vector<bitset<256>> classes;
+    switch (kind) {
+    case TermKind::EMPTY:
+    case TermKind::EPSILON:
+        classes.push_back(alphabet());
+        break;
+    case TermKind::CHARS: {
+        bitset<256> inside = terms[term].chars & alphabet();
+        bitset<256> outside = alphabet() & ~terms[term].chars;
+        if (inside.any()) {
+            classes.push_back(inside);
+        }
+        if (outside.any()) {
+            classes.push_back(outside);
+        }
+        break;
+    }
+    case TermKind::CONCAT:
+        classes = derivativeClasses(children[0]);
+        if (terms[children[0]].nullable) {
+            classes = meet(classes, derivativeClasses(children[1]));
+        }
+        break;
+    case TermKind::STAR:
+    case TermKind::REPEAT:
+    case TermKind::NOT:
+        classes = derivativeClasses(children[0]);
+        break;
+    case TermKind::OR:
+    case TermKind::AND:
+        classes = derivativeClasses(children[0]);
+        for (size_t i = 1; i < children.size(); i++) {
+            classes = meet(classes, derivativeClasses(children[i]));
+        }
+        break;
+    }
+
+    return classCache[term] = classes;
+}
+
+vector<bitset<256>>
+DerivativeConstruction::meet(const vector<bitset<256>> &a,
+                             const vector<bitset<256>> &b) {
+    vector<bitset<256>> result;
+    for (const auto &x : a) {
+        for (const auto &y : b) {
+            bitset<256> both = x & y;
+            if (both.any()) {
+                result.push_back(both);
+            }
+        }
+    }
+    return result;
+}
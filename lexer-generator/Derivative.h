@@ -0,0 +1,89 @@
+#pragma once
+#include "DFA.h"
+#include "RegexAST.h"
+#include <bitset>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// Brzozowski导数构造：不经过NFA，直接由正则表达式AST构造DFA
+//   - DFA状态是规范化后的正则表达式项，a 上的转换指向该项对 a 的导数
+//   - 项经过哈希共享（相同结构只存一份），比较两个项只需比较编号
+//   - 原生支持交（&）和补（~），不需要乘积构造
+//   - 只对导数可能不同的字符类求导，而不是对每个字符求导
+//   - 计数重复 r{m,n} 是一个项，子项 r 在各次数之间共享
+// 规范化只做相似性化简（并/交的结合、交换、幂等等），得到的DFA通常接近
+// 最小但不保证最小
+class DerivativeConstruction {
+  public:
+    DerivativeConstruction();
+
+    // 将AST转换为DFA（不含无法到达接受状态的死状态）
+    shared_ptr<DFA> build(shared_ptr<ASTNode> ast);
+
+    // AST中是否使用了只有导数构造支持的交或补
+    static bool needsDerivatives(shared_ptr<ASTNode> ast);
+
+  private:
+    enum class TermKind {
+        EMPTY,
+        EPSILON,
+        CHARS,
+        CONCAT,
+        STAR,
+        REPEAT,
+        OR,
+        AND,
+        NOT
+    };
+
+    // 规范化的正则表达式项；OR 和 AND 的子项按编号排序且不重复
+    struct Term {
+        TermKind kind;
+        bitset<256> chars;    // CHARS：匹配的字符集合
+        vector<int> children; // 子项编号
+        bool nullable;        // 是否能匹配空串
+        int min;              // REPEAT：最少重复次数
+        int max;              // REPEAT：最多重复次数，-1 表示无上限
+    };
+
+    vector<Term> terms;
+    unordered_map<string, int> termTable; // 项的结构 -> 编号（哈希共享）
+    unordered_map<long long, int> derivativeCache; // 项编号*256+字符 -> 导数
+    unordered_map<int, vector<bitset<256>>> classCache; // 项编号 -> 字符类
+
+    int emptyTerm;    // ∅：不匹配任何串
+    int epsilonTerm;  // ε
+    int universeTerm; // ~∅：匹配任何串
+
+    // 查找或创建项，返回编号
+    int intern(const Term &term);
+
+    // 构造项，同时做规范化
+    int makeChars(const bitset<256> &chars);
+    int makeConcat(int left, int right);
+    int makeStar(int child);
+    int makeRepeat(int child, int min, int max);
+    int makeOr(vector<int> children);
+    int makeAnd(vector<int> children);
+    int makeNot(int child);
+
+    // AST -> 项
+    int fromAST(shared_ptr<ASTNode> node);
+
+    // 单字符节点对应的项
+    int fromCharSet(bitset<256> chars);
+
+    // 项对字符 ch 的导数
+    int derivative(int term, unsigned char ch);
+
+    // 把字母表划分为若干字符类，同一类中的字符导数相同
+    const vector<bitset<256>> &derivativeClasses(int term);
+
+    // 两个划分的交
+    static vector<bitset<256>> meet(const vector<bitset<256>> &a,
+                                    const vector<bitset<256>> &b);
+};
@@ -1,7 +1,10 @@
 #include "FileParser.h"
+#include <algorithm>
+#include <cctype>
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
 
 using namespace std;
 
@@ -33,20 +36,232 @@ vector<LexerRule> FileParser::readLexerRules(const string &filename) {
         istringstream iss(line);
         LexerRule rule;
 
-        // 读取token类型
+        // 读取token类型，前面可以有 <MODE,...> 形式的起始条件
         iss >> rule.tokenType;
+        if (!rule.tokenType.empty() && rule.tokenType[0] == '<') {
+            size_t close = rule.tokenType.find('>');
+            if (close == string::npos) {
+                throw runtime_error("起始条件缺少 '>': " + line);
+            }
+            istringstream modes(rule.tokenType.substr(1, close - 1));
+            string mode;
+            while (getline(modes, mode, ',')) {
+                mode = trim(mode);
+                if (!mode.empty()) {
+                    rule.modes.push_back(mode);
+                }
+            }
+            rule.tokenType = rule.tokenType.substr(close + 1);
+            if (rule.tokenType.empty()) {
+                iss >> rule.tokenType;
+            }
+        }
 
         string rest;
         getline(iss, rest);
-        rule.ignore = rest.find("IGNORE") != string::npos;
+        rest = trim(rest);
 
-        if (rule.ignore) {
-            rest = rest.substr(0, rest.find("IGNORE"));
+        // 行尾的标记（顺序任意）：IGNORE 匹配后跳过，ICASE 不区分大小写，
+        // INT64/DOUBLE/UNESCAPE/INTERN 为字面量的解码方式，PUSH(NAME)/POP
+        // 切换模式
+        rule.ignore = false;
+        rule.decode = LiteralDecode::NONE;
+        rule.popMode = false;
+        bool ignoreCase = false;
+        while (true) {
+            size_t space = rest.find_last_of(" \t");
+            if (space == string::npos) {
+                break;
+            }
+            string flag = rest.substr(space + 1);
+            if (flag == "IGNORE") {
+                rule.ignore = true;
+            } else if (flag == "ICASE") {
+                ignoreCase = true;
+            } else if (flag == "INT64") {
+                rule.decode = LiteralDecode::INT64;
+            } else if (flag == "DOUBLE") {
+                rule.decode = LiteralDecode::DOUBLE;
+            } else if (flag == "UNESCAPE") {
+                rule.decode = LiteralDecode::UNESCAPE;
+            } else if (flag == "INTERN") {
+                rule.decode = LiteralDecode::INTERN;
+            } else if (flag == "POP") {
+                rule.popMode = true;
+            } else if (flag.size() > 6 && flag.compare(0, 5, "PUSH(") == 0 &&
+                       flag.back() == ')') {
+                rule.pushMode = flag.substr(5, flag.size() - 6);
+            } else {
+                break;
+            }
+            rest = trim(rest.substr(0, space));
         }
-        rule.regex = trim(rest);
+        // ICASE 转换为内联修饰符，引用该规则的 {NAME} 也不区分大小写
+        rule.regex = ignoreCase ? "(?i:" + rest + ")" : rest;
 
         rules.push_back(rule);
     }
 
+    // 模式名用作生成代码中的标识符 MODE_NAME；每个模式都要有规则，
+    // 否则进入该模式后任何输入都无法识别
+    for (const string &mode : collectModes(rules)) {
+        for (char c : mode) {
+            if (!isalnum(static_cast<unsigned char>(c)) && c != '_') {
+                throw runtime_error("模式名只能包含字母、数字和下划线: " +
+                                    mode);
+            }
+        }
+        bool used = false;
+        for (const auto &rule : rules) {
+            used = used || rule.activeIn(mode);
+        }
+        if (!used) {
+            throw runtime_error("模式 " + mode + " 没有规则");
+        }
+    }
+
+    // 展开规则引用 {NAME}
+    map<string, string> definitions;
+    for (const auto &rule : rules) {
+        definitions[rule.tokenType] = rule.regex;
+    }
+    map<string, string> expanded;
+    for (auto &rule : rules) {
+        set<string> visiting;
+        visiting.insert(rule.tokenType);
+        rule.regex =
+            expandReferences(rule.regex, definitions, expanded, visiting);
+    }
+
     return rules;
 }
+
+bool LexerRule::activeIn(const string &mode) const {
+    if (modes.empty()) {
+        return mode == "INITIAL";
+    }
+    for (const string &m : modes) {
+        if (m == mode || m == "*") {
+            return true;
+        }
+    }
+    return false;
+}
+
+vector<string> FileParser::collectModes(const vector<LexerRule> &rules) {
+    vector<string> modes(1, "INITIAL");
+    auto add = [&modes](const string &mode) {
+        if (mode != "*" && find(modes.begin(), modes.end(), mode) ==
+                               modes.end()) {
+            modes.push_back(mode);
+        }
+    };
+    for (const auto &rule : rules) {
+        for (const string &mode : rule.modes) {
+            add(mode);
+        }
+        if (!rule.pushMode.empty()) {
+            add(rule.pushMode);
+        }
+    }
+    return modes;
+}
+
+string FileParser::expandReferences(const string &regex,
+                                    const map<string, string> &definitions,
+                                    map<string, string> &expanded,
+                                    set<string> &visiting) {
+    string result;
+    bool inCharset = false;
+    for (size_t i = 0; i < regex.length(); i++) {
+        char ch = regex[i];
+        if (ch == '\\' && i + 1 < regex.length()) {
+            // 转义字符原样保留
+            result += regex.substr(i, 2);
+            i++;
+            continue;
+        }
+        if (inCharset) {
+            inCharset = ch != ']';
+            result += ch;
+            continue;
+        }
+        if (ch == '[') {
+            inCharset = true;
+            result += ch;
+            continue;
+        }
+
+        // {NAME}：NAME 以字母或下划线开头（以数字开头的花括号不是引用）
+        size_t close = regex.find('}', i);
+        if (ch != '{' || close == string::npos || i + 1 == close ||
+            isdigit(static_cast<unsigned char>(regex[i + 1]))) {
+            result += ch;
+            continue;
+        }
+        string name = regex.substr(i + 1, close - i - 1);
+        bool isName = true;
+        for (char c : name) {
+            isName = isName && (isalnum(static_cast<unsigned char>(c)) ||
+                                c == '_');
+        }
+        if (!isName) {
+            result += ch;
+            continue;
+        }
+
+        if (definitions.find(name) == definitions.end()) {
+            throw runtime_error("未定义的规则引用: {" + name + "}");
+        }
+        if (visiting.count(name)) {
+            throw runtime_error("规则循环引用: {" + name + "}");
+        }
+        if (expanded.find(name) == expanded.end()) {
+            visiting.insert(name);
+            expanded[name] = expandReferences(definitions.at(name), definitions,
+                                              expanded, visiting);
+            visiting.erase(name);
+        }
+        result += "(" + expanded[name] + ")";
+        i = close;
+    }
+    return result;
+}
+
+// 读取剖析文件
+LexerProfile FileParser::readLexerProfile(const string &filename) {
+    LexerProfile profile;
+
+    ifstream file(filename);
+    if (!file.is_open()) {
+        cerr << "Failed to open file: " << filename << endl;
+        return profile;
+    }
+
+    string line;
+    while (getline(file, line)) {
+        if (line.empty() || line[0] == '#')
+            continue;
+
+        istringstream iss(line);
+        string kind;
+        iss >> kind;
+
+        if (kind == "state") {
+            string tokenType;
+            int stateId;
+            long long count;
+            if (iss >> tokenType >> stateId >> count) {
+                profile.stateVisits[tokenType][stateId] += count;
+            }
+        } else if (kind == "token") {
+            string tokenType;
+            long long count;
+            if (iss >> tokenType >> count) {
+                profile.tokenCounts[tokenType] += count;
+            }
+        }
+    }
+
+    return profile;
+}
@@ -1,16 +1,64 @@
 #pragma once
+#include <map>
+#include <set>
 #include <string>
 #include <vector>
 
 using namespace std;
 
+// 字面量解码：匹配成功后把记号文本转换为二进制值存入 Token
+enum class LiteralDecode {
+    NONE,
+    INT64,   // 十进制整数 -> Token::intValue
+    DOUBLE,  // 十进制浮点数 -> Token::floatValue
+    UNESCAPE, // 去掉首尾引号并处理转义 -> Token::stringValue
+    INTERN    // 放入 Lexer 的符号表 -> Token::symbol
+};
+
 struct LexerRule {
     string tokenType;
     string regex;
     bool ignore;
+    LiteralDecode decode;
+
+    // 起始条件：规则所属的模式（行首的 <A,B>，* 表示所有模式），
+    // 为空时只属于 INITIAL。模式是排他的，不带前缀的规则在其他模式中不生效
+    vector<string> modes;
+    string pushMode; // PUSH(NAME)：匹配后进入模式 NAME，原模式压栈
+    bool popMode;    // POP：匹配后回到栈顶的模式（栈空时回到 INITIAL）
+
+    bool activeIn(const string &mode) const;
+};
+
+// 词法分析器运行剖析数据（由带计数器的词法分析器记录）
+// 状态编号统一使用从起始状态BFS得到的规范编号，与生成时采用的状态布局无关
+struct LexerProfile {
+    // token类型 -> (规范状态编号 -> 访问次数)
+    map<string, map<int, long long>> stateVisits;
+    // token类型 -> 匹配成功次数（含 IGNORE 规则）
+    map<string, long long> tokenCounts;
+
+    bool empty() const { return stateVisits.empty() && tokenCounts.empty(); }
 };
 
 class FileParser {
   public:
+    // 读取词法规则文件；正则表达式中的 {NAME} 引用名为 NAME 的规则的正则
+    // 表达式（可以引用文件中任意位置的规则），读取后展开为 (...)
     vector<LexerRule> readLexerRules(const string &filename);
+
+    // 读取剖析文件，每行格式：
+    //   state <TOKEN_TYPE> <状态编号> <访问次数>
+    //   token <TOKEN_TYPE> <匹配次数>
+    LexerProfile readLexerProfile(const string &filename);
+
+    // 规则用到的所有模式：INITIAL 在前，其余按首次出现的顺序
+    static vector<string> collectModes(const vector<LexerRule> &rules);
+
+  private:
+    // 展开正则表达式中的规则引用，visiting 用于检测循环引用
+    string expandReferences(const string &regex,
+                            const map<string, string> &definitions,
+                            map<string, string> &expanded,
+                            set<string> &visiting);
 };
@@ -0,0 +1,242 @@
+#include "Glushkov.h"
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+shared_ptr<NFA> GlushkovConstruction::build(shared_ptr<ASTNode> ast) {
+    if (!ast) {
+        throw runtime_error("AST节点为空");
+    }
+
+    positions.clear();
+    follow.clear();
+    PositionInfo info = analyze(ast);
+
+    // 状态0为起始状态，位置 p 对应状态 p + 1
+    vector<shared_ptr<NFAState>> states;
+    for (size_t i = 0; i <= positions.size(); i++) {
+        states.push_back(make_shared<NFAState>(static_cast<int>(i)));
+    }
+
+    // 进入位置 q 的转换总是标记为 q 的字符集合
+    auto addEdges = [&](shared_ptr<NFAState> from, int q) {
+        for (char ch : positions[q]) {
+            from->addTransition(ch, states[q + 1]);
+        }
+    };
+    for (int q : info.first) {
+        addEdges(states[0], q);
+    }
+    for (size_t p = 0; p < positions.size(); p++) {
+        // 嵌套的闭包可能重复加入同一位置
+        sort(follow[p].begin(), follow[p].end());
+        follow[p].erase(unique(follow[p].begin(), follow[p].end()),
+                        follow[p].end());
+        for (int q : follow[p]) {
+            addEdges(states[p + 1], q);
+        }
+    }
+
+    vector<shared_ptr<NFAState>> finals;
+    if (info.nullable) {
+        finals.push_back(states[0]);
+    }
+    for (int p : info.last) {
+        finals.push_back(states[p + 1]);
+    }
+
+    auto nfa = make_shared<NFA>(states[0], finals);
+    nfa->epsilonFree = true;
+    return nfa;
+}
+
+GlushkovConstruction::PositionInfo
+GlushkovConstruction::analyze(shared_ptr<ASTNode> node) {
+    switch (node->type) {
+    case NodeType::CHAR: {
+        char ch = dynamic_pointer_cast<CharNode>(node)->ch;
+        if (ch == '\0') {
+            return PositionInfo{true, {}, {}};
+        }
+        return newPosition(false, vector<char>(1, ch));
+    }
+    case NodeType::CHARSET: {
+        auto charset = dynamic_pointer_cast<CharsetNode>(node);
+        bitset<256> chars;
+        for (char ch : charset->chars) {
+            chars.set(static_cast<unsigned char>(ch));
+        }
+        if (charset->negated) {
+            chars.flip();
+            chars.reset('\n');
+            chars.reset(0);
+        } else if (charset->chars.empty()) {
+            // 与Thompson构造一致：空字符类等价于空串
+            return PositionInfo{true, {}, {}};
+        }
+        return buildLeaf(chars);
+    }
+    case NodeType::ANY: {
+        bitset<256> chars;
+        chars.set();
+        chars.reset('\n');
+        chars.reset(0);
+        return buildLeaf(chars);
+    }
+    case NodeType::EPSILON:
+        return PositionInfo{true, {}, {}};
+    case NodeType::CONCAT: {
+        auto concat = dynamic_pointer_cast<ConcatNode>(node);
+        PositionInfo info = analyze(concat->children[0]);
+        for (size_t i = 1; i < concat->children.size(); i++) {
+            info = concatenate(info, analyze(concat->children[i]));
+        }
+        return info;
+    }
+    case NodeType::UNION: {
+        PositionInfo info{false, {}, {}};
+        for (auto child : dynamic_pointer_cast<UnionNode>(node)->children) {
+            PositionInfo branch = analyze(child);
+            info.nullable = info.nullable || branch.nullable;
+            info.first.insert(info.first.end(), branch.first.begin(),
+                              branch.first.end());
+            info.last.insert(info.last.end(), branch.last.begin(),
+                             branch.last.end());
+        }
+        return info;
+    }
+    case NodeType::STAR: {
+        PositionInfo info =
+            analyze(dynamic_pointer_cast<StarNode>(node)->child);
+        link(info.last, info.first);
+        info.nullable = true;
+        return info;
+    }
+    case NodeType::PLUS: {
+        PositionInfo info =
+            analyze(dynamic_pointer_cast<PlusNode>(node)->child);
+        link(info.last, info.first);
+        return info;
+    }
+    case NodeType::REPEAT: {
+        // 子表达式只分析一次，其余副本按位置编号平移复制。
+        // 可选的副本嵌套为 (r(r(r)?)?)?，使 follow 集合的总大小与副本数成线性
+        auto repeat = dynamic_pointer_cast<RepeatNode>(node);
+        int base = static_cast<int>(positions.size());
+        PositionInfo pattern = analyze(repeat->child);
+        // 模板的 follow 在连接时会加入指向外部的位置，复制前先保存
+        vector<vector<int>> patternFollow(follow.begin() + base, follow.end());
+        bool patternUsed = false;
+        auto nextCopy = [&]() {
+            if (!patternUsed) {
+                patternUsed = true;
+                return pattern;
+            }
+            return copyPositions(pattern, base, patternFollow);
+        };
+
+        PositionInfo info{true, {}, {}};
+        for (int i = 0; i < repeat->min; i++) {
+            info = concatenate(info, nextCopy());
+        }
+        if (repeat->max == -1) {
+            PositionInfo loop = nextCopy();
+            link(loop.last, loop.first);
+            loop.nullable = true;
+            info = concatenate(info, loop);
+        } else if (repeat->max > repeat->min) {
+            vector<PositionInfo> copies;
+            for (int i = repeat->min; i < repeat->max; i++) {
+                copies.push_back(nextCopy());
+            }
+            PositionInfo optional{true, {}, {}};
+            for (size_t i = copies.size(); i-- > 0;) {
+                optional = concatenate(copies[i], optional);
+                optional.nullable = true;
+            }
+            info = concatenate(info, optional);
+        }
+        return info;
+    }
+    case NodeType::INTERSECT:
+    case NodeType::COMPLEMENT:
+        throw runtime_error(
+            "Glushkov构造不支持交（&）和补（~），请使用导数构造");
+    default:
+        throw runtime_error("未知的AST节点类型");
+    }
+}
+
+GlushkovConstruction::PositionInfo
+GlushkovConstruction::buildLeaf(const bitset<256> &chars) {
+    // NFA用 '\0' 表示epsilon，与Thompson构造一致，集合中的 '\0' 按空串处理
+    vector<char> labels;
+    for (int ch = 1; ch < 256; ch++) {
+        if (chars.test(ch)) {
+            labels.push_back(static_cast<char>(ch));
+        }
+    }
+    if (labels.empty()) {
+        return PositionInfo{true, {}, {}};
+    }
+    return newPosition(chars.test(0), labels);
+}
+
+GlushkovConstruction::PositionInfo
+GlushkovConstruction::newPosition(bool nullable, const vector<char> &labels) {
+    int position = static_cast<int>(positions.size());
+    positions.push_back(labels);
+    follow.emplace_back();
+    return PositionInfo{nullable, {position}, {position}};
+}
+
+GlushkovConstruction::PositionInfo
+GlushkovConstruction::concatenate(const PositionInfo &left,
+                                  const PositionInfo &right) {
+    link(left.last, right.first);
+
+    PositionInfo info;
+    info.nullable = left.nullable && right.nullable;
+    info.first = left.first;
+    if (left.nullable) {
+        info.first.insert(info.first.end(), right.first.begin(),
+                          right.first.end());
+    }
+    info.last = right.last;
+    if (right.nullable) {
+        info.last.insert(info.last.end(), left.last.begin(), left.last.end());
+    }
+    return info;
+}
+
+GlushkovConstruction::PositionInfo
+GlushkovConstruction::copyPositions(const PositionInfo &info, int base,
+                                    const vector<vector<int>> &internalFollow) {
+    int offset = static_cast<int>(positions.size()) - base;
+    for (size_t i = 0; i < internalFollow.size(); i++) {
+        vector<char> labels = positions[base + i];
+        positions.push_back(labels);
+        vector<int> shifted;
+        for (int q : internalFollow[i]) {
+            shifted.push_back(q + offset);
+        }
+        follow.push_back(shifted);
+    }
+
+    PositionInfo copy{info.nullable, {}, {}};
+    for (int p : info.first) {
+        copy.first.push_back(p + offset);
+    }
+    for (int p : info.last) {
+        copy.last.push_back(p + offset);
+    }
+    return copy;
+}
+
+void GlushkovConstruction::link(const vector<int> &from,
+                                const vector<int> &to) {
+    for (int p : from) {
+        follow[p].insert(follow[p].end(), to.begin(), to.end());
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "NFA.h"
+#include "RegexAST.h"
+#include <bitset>
+#include <memory>
+#include <vector>
+
+using namespace std;
+
+// Glushkov构造（位置自动机）：直接由正则表达式AST计算 first、last、follow
+// 集合构造NFA。每个字符位置恰好对应一个状态，外加一个起始状态，没有epsilon
+// 转换，所以子集构造不需要计算epsilon闭包
+class GlushkovConstruction {
+  public:
+    // 将AST转换为无epsilon转换的NFA
+    shared_ptr<NFA> build(shared_ptr<ASTNode> ast);
+
+  private:
+    // 子表达式的位置信息
+    struct PositionInfo {
+        bool nullable;     // 是否能匹配空串
+        vector<int> first; // 可作为第一个字符的位置
+        vector<int> last;  // 可作为最后一个字符的位置
+    };
+
+    vector<vector<char>> positions; // 每个位置匹配的字符
+    vector<vector<int>> follow;     // 每个位置之后可以出现的位置
+
+    // 递归计算 nullable、first、last，同时填充 follow
+    PositionInfo analyze(shared_ptr<ASTNode> node);
+
+    // 字符类节点：新建一个位置，不含任何字符时等价于空串
+    PositionInfo buildLeaf(const bitset<256> &chars);
+
+    // 新建一个匹配 labels 中字符的位置
+    PositionInfo newPosition(bool nullable, const vector<char> &labels);
+
+    // 连接两个子表达式：left 的 last 连到 right 的 first
+    PositionInfo concatenate(const PositionInfo &left,
+                             const PositionInfo &right);
+
+    // 复制从 base 开始的一段位置（internalFollow 为这些位置内部的 follow），
+    // 返回平移后的位置信息
+    PositionInfo copyPositions(const PositionInfo &info, int base,
+                               const vector<vector<int>> &internalFollow);
+
+    // 把 from 中每个位置的 follow 加上 to 中的所有位置
+    void link(const vector<int> &from, const vector<int> &to);
+};
@@ -31,12 +31,21 @@ class NFAState {
 class NFA {
   public:
     shared_ptr<NFAState> start;  // 起始状态
-    shared_ptr<NFAState> accept; // 接受状态
+    shared_ptr<NFAState> accept; // 接受状态（有多个接受状态时为空）
+    bool epsilonFree = false;    // 没有epsilon转换时子集构造可跳过闭包计算
 
     NFA(shared_ptr<NFAState> s, shared_ptr<NFAState> a) : start(s), accept(a) {
         accept->isAccepting = true;
     }
 
+    // 多个接受状态的NFA（如Glushkov构造的结果）
+    NFA(shared_ptr<NFAState> s, const vector<shared_ptr<NFAState>> &finals)
+        : start(s) {
+        for (auto state : finals) {
+            state->isAccepting = true;
+        }
+    }
+
     // 计算epsilon闭包
     set<shared_ptr<NFAState>>
     epsilonClosure(const set<shared_ptr<NFAState>> &states);
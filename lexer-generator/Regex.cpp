@@ -0,0 +1,363 @@
+#include "Regex.h"
+#include "DFAMinimizer.h"
+#include "Derivative.h"
+#include "RegexParser.h"
+#include "RegexSimplifier.h"
+#include "SubsetConstruction.h"
+#include "Thompson.h"
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+using namespace std;
+
+Regex::Regex(const string &pattern) : pattern(pattern) {
+    dfa = compile(pattern);
+    nullable = dfa.accepting[0];
+    analyzePrefix();
+    buildUnanchored();
+    buildReverse();
+}
+
+FlatDFA Regex::compile(const string &pattern) {
+    RegexParser regexParser;
+    RegexSimplifier simplifier;
+    DFAMinimizer minimizer;
+    auto ast = regexParser.parse(pattern);
+    // 字面串的并（如关键字表）由字典树直接得到最小DFA，在化简（提取公共
+    // 前缀）之前判断
+    shared_ptr<DFA> result = ThompsonConstruction::buildLiteralDFA(ast);
+    if (!result) {
+        ast = simplifier.simplify(ast);
+    }
+    if (!result && DerivativeConstruction::needsDerivatives(ast)) {
+        // 交和补只有导数构造支持
+        DerivativeConstruction derivative;
+        result = minimizer.minimize(derivative.build(ast));
+    } else if (!result) {
+        ThompsonConstruction thompson;
+        SubsetConstruction subset;
+        result = minimizer.minimize(subset.convert(thompson.build(ast)));
+    }
+    return FlatDFA::fromDFA(result);
+}
+
+void Regex::analyzePrefix() {
+    for (int b = 0; b < 256; b++) {
+        first[b] = dfa.transitions[b] != -1;
+    }
+
+    // 从起始状态出发，只要当前状态不接受且只有一条出边，这条边的字节就是
+    // 所有匹配都必须经过的
+    int state = 0;
+    while (!dfa.accepting[state] &&
+           prefix.size() < static_cast<size_t>(dfa.stateCount)) {
+        int only = -1;
+        for (int b = 0; b < 256; b++) {
+            if (dfa.transitions[state * 256 + b] != -1) {
+                if (only != -1) {
+                    only = -1;
+                    break;
+                }
+                only = b;
+            }
+        }
+        if (only == -1) {
+            break;
+        }
+        prefix += static_cast<char>(only);
+        state = dfa.transitions[state * 256 + only];
+    }
+}
+
+void Regex::buildUnanchored() {
+    // 每个状态是锚定DFA的状态集合，总是包含起始状态0（任意位置都可以开始）
+    map<vector<int>, int> ids;
+    vector<vector<int>> sets(1, vector<int>(1, 0));
+    ids[sets[0]] = 0;
+    vector<int> transitions;
+    vector<bool> accepting;
+    for (size_t k = 0; k < sets.size(); k++) {
+        if (sets.size() > static_cast<size_t>(MAX_UNANCHORED_STATES)) {
+            return;
+        }
+        bool accept = false;
+        for (int q : sets[k]) {
+            accept = accept || dfa.accepting[q];
+        }
+        accepting.push_back(accept);
+        for (int b = 0; b < 256; b++) {
+            vector<int> next(1, 0);
+            for (int q : sets[k]) {
+                int t = dfa.transitions[q * 256 + b];
+                if (t > 0) {
+                    next.push_back(t);
+                }
+            }
+            sort(next.begin(), next.end());
+            next.erase(unique(next.begin(), next.end()), next.end());
+            auto it = ids.find(next);
+            if (it == ids.end()) {
+                it = ids.insert(make_pair(next, static_cast<int>(sets.size())))
+                         .first;
+                sets.push_back(next);
+            }
+            transitions.push_back(it->second);
+        }
+    }
+    unanchored.stateCount = static_cast<int>(sets.size());
+    unanchored.transitions = transitions;
+    unanchored.accepting = accepting;
+}
+
+void Regex::buildReverse() {
+    // 按字节分组的计数排序
+    reverseOffset.assign(257, 0);
+    for (int q = 0; q < dfa.stateCount; q++) {
+        for (int b = 0; b < 256; b++) {
+            if (dfa.transitions[q * 256 + b] != -1) {
+                reverseOffset[b + 1]++;
+            }
+        }
+    }
+    for (int b = 0; b < 256; b++) {
+        reverseOffset[b + 1] += reverseOffset[b];
+    }
+    reverseEdges.resize(reverseOffset[256] * 2);
+    vector<int> fill(reverseOffset.begin(), reverseOffset.end() - 1);
+    for (int q = 0; q < dfa.stateCount; q++) {
+        for (int b = 0; b < 256; b++) {
+            int t = dfa.transitions[q * 256 + b];
+            if (t != -1) {
+                reverseEdges[fill[b] * 2] = q;
+                reverseEdges[fill[b] * 2 + 1] = t;
+                fill[b]++;
+            }
+        }
+    }
+}
+
+const unsigned char *Regex::leftmostBound(const unsigned char *from,
+                                          const unsigned char *matchEnd,
+                                          bool lines, bool &single) const {
+    // alive[q] == p 表示状态 q 从 p 读到 matchEnd 不会失败；在 matchEnd 处
+    // 所有状态都满足。每个字节只看这个字节上的边，不必遍历所有状态。
+    // 新的标记先记在 born 中，本字节的边都看完后再写入
+    vector<const unsigned char *> alive(dfa.stateCount, nullptr);
+    vector<int> born;
+    const unsigned char *bound = matchEnd;
+    int candidates = 0;
+    for (const unsigned char *p = matchEnd; p > from;) {
+        p--;
+        if (lines && *p == '\n') {
+            break;
+        }
+        born.clear();
+        const int *edge = reverseEdges.data() + reverseOffset[*p] * 2;
+        const int *last = reverseEdges.data() + reverseOffset[*p + 1] * 2;
+        for (; edge < last; edge += 2) {
+            if (p + 1 == matchEnd || alive[edge[1]] == p + 1) {
+                born.push_back(edge[0]);
+            }
+        }
+        if (born.empty()) {
+            break;
+        }
+        for (int q : born) {
+            alive[q] = p;
+        }
+        if (alive[0] == p) {
+            bound = p;
+            candidates++;
+        }
+    }
+    single = candidates == 1;
+    return bound;
+}
+
+bool Regex::leftmostLongest(const unsigned char *begin,
+                            const unsigned char *from,
+                            const unsigned char *end, bool lines,
+                            RegexMatch &match) const {
+    struct Thread {
+        int state;
+        const unsigned char *start;
+    };
+    const int *transitions = dfa.transitions.data();
+    // 按起点从小到大排列；claimed[q] == p 表示位置 p 上状态 q 已被占用
+    vector<Thread> threads, next;
+    vector<const unsigned char *> claimed(dfa.stateCount, nullptr);
+    const unsigned char *bestStart = nullptr;
+    const unsigned char *bestEnd = nullptr;
+    for (const unsigned char *p = from;; p++) {
+        // 还没有匹配时从 p 开始一个新的尝试，更晚的起点不可能更靠左
+        if (!bestStart && (nullable || (p < end && first[*p])) &&
+            claimed[0] != p) {
+            threads.push_back(Thread{0, p});
+            if (nullable) {
+                bestStart = bestEnd = p;
+            }
+        }
+        if (p == end || threads.empty()) {
+            if (bestStart || p == end) {
+                break;
+            }
+            continue;
+        }
+
+        next.clear();
+        for (const Thread &thread : threads) {
+            if (bestStart && thread.start > bestStart) {
+                break; // 起点晚于已有匹配的尝试不再需要
+            }
+            int t = lines && *p == '\n' ? -1
+                                         : transitions[thread.state * 256 + *p];
+            if (t == -1 || claimed[t] == p + 1) {
+                continue;
+            }
+            claimed[t] = p + 1;
+            next.push_back(Thread{t, thread.start});
+            if (dfa.accepting[t] && (!bestStart || thread.start <= bestStart)) {
+                bestStart = thread.start;
+                bestEnd = p + 1;
+            }
+        }
+        threads.swap(next);
+    }
+    if (!bestStart) {
+        return false;
+    }
+    match.position = static_cast<size_t>(bestStart - begin);
+    match.length = static_cast<size_t>(bestEnd - bestStart);
+    return true;
+}
+
+bool Regex::fullMatch(const string &text) const {
+    int state = 0;
+    for (char ch : text) {
+        state = dfa.transitions[state * 256 + static_cast<unsigned char>(ch)];
+        if (state == -1) {
+            return false;
+        }
+    }
+    return dfa.accepting[state];
+}
+
+// 在 [p, end) 中查找 prefix 的第一次出现，找不到时返回 nullptr
+static const unsigned char *findPrefix(const unsigned char *p,
+                                       const unsigned char *end,
+                                       const string &prefix) {
+    size_t n = prefix.size();
+    unsigned char head = static_cast<unsigned char>(prefix[0]);
+    while (static_cast<size_t>(end - p) >= n) {
+        p = static_cast<const unsigned char *>(
+            memchr(p, head, end - p - n + 1));
+        if (!p) {
+            return nullptr;
+        }
+        if (memcmp(p + 1, prefix.data() + 1, n - 1) == 0) {
+            return p;
+        }
+        p++;
+    }
+    return nullptr;
+}
+
+bool Regex::search(const char *textBegin, const char *textEnd,
+                   RegexMatch &match) const {
+    return find(textBegin, textEnd, match, false);
+}
+
+bool Regex::searchLines(const char *textBegin, const char *textEnd,
+                        RegexMatch &match) const {
+    return find(textBegin, textEnd, match, true);
+}
+
+bool Regex::find(const char *textBegin, const char *textEnd,
+                 RegexMatch &match, bool lines) const {
+    const unsigned char *begin =
+        reinterpret_cast<const unsigned char *>(textBegin);
+    const unsigned char *end = reinterpret_cast<const unsigned char *>(textEnd);
+
+    // 按行查找时匹配不能包含换行符
+    if (lines && prefix.find('\n') != string::npos) {
+        return false;
+    }
+
+    // 1. 前缀筛选：所有匹配都以前缀开头，第一次出现之前不可能开始匹配
+    const unsigned char *from = begin;
+    if (!prefix.empty()) {
+        from = findPrefix(begin, end, prefix);
+        if (!from) {
+            return false;
+        }
+    }
+
+    // 2. 非锚定DFA线性扫描，找到最早结束的匹配，找不到时整段都没有匹配。
+    //    按行查找时换行符处回到起始状态，最早结束的匹配所在行之前的行都
+    //    没有匹配。再从它的终点反向扫描求出最左起点的下界，通常这时已经
+    //    只剩一个可能的起点
+    if (unanchored.stateCount > 0 && !nullable) {
+        const int *transitions = unanchored.transitions.data();
+        int state = 0;
+        const unsigned char *p = from;
+        if (lines) {
+            for (; p < end; p++) {
+                state = *p == '\n' ? 0 : transitions[state * 256 + *p];
+                if (unanchored.accepting[state]) {
+                    break;
+                }
+            }
+        } else {
+            for (; p < end; p++) {
+                state = transitions[state * 256 + *p];
+                if (unanchored.accepting[state]) {
+                    break;
+                }
+            }
+        }
+        if (p == end) {
+            return false;
+        }
+        if (lines) {
+            const unsigned char *lineStart = p;
+            while (lineStart > from && lineStart[-1] != '\n') {
+                lineStart--;
+            }
+            from = lineStart;
+        }
+        bool single;
+        from = leftmostBound(from, p + 1, lines, single);
+        if (single) {
+            // 只有一个可能的起点（常见情况），直接在锚定DFA上取最长匹配
+            const unsigned char *last = nullptr;
+            state = 0;
+            for (p = from; p < end && !(lines && *p == '\n'); p++) {
+                state = dfa.transitions[state * 256 + *p];
+                if (state == -1) {
+                    break;
+                }
+                if (dfa.accepting[state]) {
+                    last = p + 1;
+                }
+            }
+            match.position = static_cast<size_t>(from - begin);
+            match.length = static_cast<size_t>(last - from);
+            return true;
+        }
+    }
+
+    // 3. 从下界开始一次正向扫描，同时跟踪各个起点，得到最左最长匹配
+    return leftmostLongest(begin, from, end, lines, match);
+}
+
+bool Regex::search(const string &text, RegexMatch &match, size_t from) const {
+    if (from > text.size()) {
+        return false;
+    }
+    if (!search(text.data() + from, text.data() + text.size(), match)) {
+        return false;
+    }
+    match.position += from;
+    return true;
+}
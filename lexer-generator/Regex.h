@@ -0,0 +1,92 @@
+#pragma once
+#include "DFA.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// 一次匹配：起始位置（相对搜索的输入开头）和长度
+struct RegexMatch {
+    size_t position;
+    size_t length;
+};
+
+// 编译后的正则表达式：正则解析 -> 化简 -> Thompson构造（用到交或补时为
+// 导数构造） -> 子集构造 -> 最小化，得到扁平化的DFA，匹配时只查数组。
+// 支持整串匹配和非锚定搜索（最左最长匹配）。对象构造后只读，可以在多个
+// 线程中同时使用。正则表达式有误时构造函数抛出 runtime_error
+class Regex {
+  public:
+    explicit Regex(const string &pattern);
+
+    // 把正则表达式编译成最小化的扁平DFA（Regex 和 RegexSet 共用）
+    static FlatDFA compile(const string &pattern);
+
+    const string &getPattern() const { return pattern; }
+
+    // 所有匹配共同的字面前缀（可能为空），搜索时用 memchr 跳到前缀出现处
+    const string &getLiteralPrefix() const { return prefix; }
+
+    // 整个输入是否匹配
+    bool fullMatch(const string &text) const;
+
+    // 在 [begin, end) 中查找最左最长匹配：起始位置最小的匹配中取最长的一个
+    bool search(const char *begin, const char *end, RegexMatch &match) const;
+
+    // 从 from 开始查找，match.position 相对 text 开头
+    bool search(const string &text, RegexMatch &match, size_t from = 0) const;
+
+    // 按行查找：匹配不能包含换行符，在 [begin, end) 中找最左最长匹配所在
+    // 行中的最左最长匹配。扫描在换行符处停止，耗时与扫描过的输入长度成
+    // 线性（grep 使用）
+    bool searchLines(const char *begin, const char *end,
+                     RegexMatch &match) const;
+
+  private:
+    // 非锚定DFA的状态数上限，超过时不使用（从前缀处直接正向扫描）
+    static const int MAX_UNANCHORED_STATES = 4096;
+
+    string pattern;
+    FlatDFA dfa;       // 锚定的最小DFA，状态0为起始状态
+    string prefix;     // 字面前缀
+    bool first[256];   // 可能作为匹配首字节的字节
+    bool nullable;     // 是否匹配空串
+
+    // 非锚定DFA（相当于 Σ*r）：任意位置都可能开始匹配，用于一次线性扫描
+    // 找到最早结束的匹配；为空表示状态过多未构造
+    FlatDFA unanchored;
+
+    // 锚定DFA的反向边 (源状态, 目标状态)，按字节分组：字节 b 的边是
+    // reverseEdges 中第 reverseOffset[b] 到 reverseOffset[b + 1] 对
+    vector<int> reverseOffset;
+    vector<int> reverseEdges;
+
+    // 计算字面前缀和首字节集合
+    void analyzePrefix();
+
+    // 在锚定DFA上对状态集合做子集构造，得到非锚定DFA
+    void buildUnanchored();
+
+    // 按字节分组锚定DFA的边，供反向扫描使用
+    void buildReverse();
+
+    // 最左匹配起点的下界：从最早结束的匹配的终点 matchEnd 向左，在锚定DFA
+    // 上反向求“从该处读到 matchEnd 仍未失败”的状态集合，起始状态在集合中的
+    // 最左位置。最左匹配要么就是这个匹配，要么更早开始、更晚结束，两种情况
+    // 的起点都满足该条件。single 表示区间内只有这一个位置满足条件
+    const unsigned char *leftmostBound(const unsigned char *from,
+                                       const unsigned char *matchEnd,
+                                       bool lines, bool &single) const;
+
+    // 从 from 开始一次扫描求最左最长匹配：在锚定DFA上同时推进从各个起点
+    // 出发的状态，同一状态只保留最早的起点，每个字节的代价不超过状态数
+    bool leftmostLongest(const unsigned char *begin,
+                         const unsigned char *from, const unsigned char *end,
+                         bool lines, RegexMatch &match) const;
+
+    // search 和 searchLines 的实现：lines 为 true 时换行符处重新开始扫描，
+    // 匹配不越过行尾
+    bool find(const char *textBegin, const char *textEnd, RegexMatch &match,
+              bool lines) const;
+};
@@ -13,8 +13,11 @@ enum class NodeType {
     STAR,    // Kleene闭包，如 a*（0次或多次）
     PLUS,    // 正闭包，如 a+（1次或多次）
     CHARSET, // 字符类，如 [a-z]
-    ANY,     // 任意字符（除换行符），如 .
-    EPSILON  // 空串 ε
+    ANY,       // 任意字符（除换行符），如 .
+    EPSILON,   // 空串 ε
+    REPEAT,    // 计数重复，如 a{2,5}、a{3,}、a?（即 a{0,1}）
+    INTERSECT, // 交，如 a&b（只有导数构造支持）
+    COMPLEMENT // 补，如 ~a（只有导数构造支持）
 };
 
 class ASTNode {
@@ -29,22 +32,26 @@ class CharNode : public ASTNode {
     CharNode(char c) : ch(c) { type = NodeType::CHAR; }
 };
 
+// 连接和并是多元节点：abc 是一个有三个子节点的连接，a|b|c 同理，
+// 数千个分支的并不会形成数千层深的树
 class ConcatNode : public ASTNode {
   public:
-    shared_ptr<ASTNode> left;
-    shared_ptr<ASTNode> right;
-    ConcatNode(shared_ptr<ASTNode> l, shared_ptr<ASTNode> r)
-        : left(l), right(r) {
+    vector<shared_ptr<ASTNode>> children;
+    ConcatNode(const vector<shared_ptr<ASTNode>> &c) : children(c) {
+        type = NodeType::CONCAT;
+    }
+    ConcatNode(shared_ptr<ASTNode> l, shared_ptr<ASTNode> r) : children{l, r} {
         type = NodeType::CONCAT;
     }
 };
 
 class UnionNode : public ASTNode {
   public:
-    shared_ptr<ASTNode> left;
-    shared_ptr<ASTNode> right;
-    UnionNode(shared_ptr<ASTNode> l, shared_ptr<ASTNode> r)
-        : left(l), right(r) {
+    vector<shared_ptr<ASTNode>> children;
+    UnionNode(const vector<shared_ptr<ASTNode>> &c) : children(c) {
+        type = NodeType::UNION;
+    }
+    UnionNode(shared_ptr<ASTNode> l, shared_ptr<ASTNode> r) : children{l, r} {
         type = NodeType::UNION;
     }
 };
@@ -61,6 +68,17 @@ class PlusNode : public ASTNode {
     PlusNode(shared_ptr<ASTNode> c) : child(c) { type = NodeType::PLUS; }
 };
 
+class RepeatNode : public ASTNode {
+  public:
+    shared_ptr<ASTNode> child;
+    int min; // 最少重复次数
+    int max; // 最多重复次数，-1 表示无上限
+    RepeatNode(shared_ptr<ASTNode> c, int lo, int hi)
+        : child(c), min(lo), max(hi) {
+        type = NodeType::REPEAT;
+    }
+};
+
 class CharsetNode : public ASTNode {
   public:
     vector<char> chars;
@@ -77,3 +95,21 @@ class EpsilonNode : public ASTNode {
   public:
     EpsilonNode() { type = NodeType::EPSILON; }
 };
+
+class IntersectNode : public ASTNode {
+  public:
+    shared_ptr<ASTNode> left;
+    shared_ptr<ASTNode> right;
+    IntersectNode(shared_ptr<ASTNode> l, shared_ptr<ASTNode> r)
+        : left(l), right(r) {
+        type = NodeType::INTERSECT;
+    }
+};
+
+class ComplementNode : public ASTNode {
+  public:
+    shared_ptr<ASTNode> child;
+    ComplementNode(shared_ptr<ASTNode> c) : child(c) {
+        type = NodeType::COMPLEMENT;
+    }
+};
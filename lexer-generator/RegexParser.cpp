@@ -1,4 +1,6 @@
 #include "RegexParser.h"
+#include <algorithm>
+#include <cctype>
 #include <stdexcept>
 
 using namespace std;
@@ -6,6 +8,7 @@ using namespace std;
 shared_ptr<ASTNode> RegexParser::parse(const string &regex) {
     this->input = regex;
     this->pos = 0;
+    this->ignoreCase = false;
     return this->parseUnion();
 }
 
@@ -32,46 +35,55 @@ bool RegexParser::match(char c) {
 }
 
 shared_ptr<ASTNode> RegexParser::parseUnion() {
-    auto left = parseConcat();
+    // 解析 a|b|c，所有分支作为同一个并节点的子节点
+    //      union
+    //    /   |   \
+    //   a    b    c
+    vector<shared_ptr<ASTNode>> alternatives;
+    alternatives.push_back(parseIntersect());
+    while (match('|')) {
+        alternatives.push_back(parseIntersect());
+    }
 
-    // 解析 a|b|c
-    //       union
-    //     /      \
-    //    union    c
-    //  /      \
-    // a        b
+    if (alternatives.size() == 1) {
+        return alternatives[0];
+    }
+    return make_shared<UnionNode>(alternatives);
+}
 
-    // 实现左递归
-    while (match('|')) {
+// 交的优先级介于并和连接之间：a|b&c 即 a|(b&c)，ab&cd 即 (ab)&(cd)
+shared_ptr<ASTNode> RegexParser::parseIntersect() {
+    auto left = parseConcat();
+
+    while (match('&')) {
         auto right = parseConcat();
-        // 创建或节点，将左子树和右子树连接起来，并作为新的左子树
-        left = make_shared<UnionNode>(left, right);
+        left = make_shared<IntersectNode>(left, right);
     }
 
     return left;
 }
 
 shared_ptr<ASTNode> RegexParser::parseConcat() {
-    shared_ptr<ASTNode> left = nullptr;
-
-    // 实现左递归
-    while (!isEnd() && peek() != '|' && peek() != ')') {
-        auto node = parseRepeat();
-        if (!left) {
-            left = node;
-        } else {
-            left = make_shared<ConcatNode>(left, node);
-        }
+    vector<shared_ptr<ASTNode>> factors;
+    while (!isEnd() && peek() != '|' && peek() != '&' && peek() != ')') {
+        factors.push_back(parseRepeat());
     }
 
-    if (!left) {
+    if (factors.empty()) {
         return make_shared<EpsilonNode>();
     }
-
-    return left;
+    if (factors.size() == 1) {
+        return factors[0];
+    }
+    return make_shared<ConcatNode>(factors);
 }
 
 shared_ptr<ASTNode> RegexParser::parseRepeat() {
+    // 补是前缀运算符，作用于其后的整个重复表达式：~a* 即 ~(a*)
+    if (match('~')) {
+        return make_shared<ComplementNode>(parseRepeat());
+    }
+
     auto atom = parseAtom();
 
     while (true) {
@@ -79,6 +91,24 @@ shared_ptr<ASTNode> RegexParser::parseRepeat() {
             atom = make_shared<StarNode>(atom);
         } else if (match('+')) {
             atom = make_shared<PlusNode>(atom);
+        } else if (match('?')) {
+            atom = make_shared<RepeatNode>(atom, 0, 1);
+        } else if (peek() == '{' && pos + 1 < input.length() &&
+                   isdigit(static_cast<unsigned char>(input[pos + 1]))) {
+            // {n}、{m,}、{m,n}；{ 后面不是数字时按普通字符处理
+            advance(); // 跳过 '{'
+            int min = parseCount();
+            int max = min;
+            if (match(',')) {
+                max = peek() == '}' ? -1 : parseCount();
+            }
+            if (!match('}')) {
+                throw runtime_error("重复次数缺少右花括号");
+            }
+            if (max != -1 && min > max) {
+                throw runtime_error("重复次数范围无效: 下限大于上限");
+            }
+            atom = make_shared<RepeatNode>(atom, min, max);
         } else {
             break;
         }
@@ -90,12 +120,27 @@ shared_ptr<ASTNode> RegexParser::parseRepeat() {
 shared_ptr<ASTNode> RegexParser::parseAtom() {
     char ch = peek();
 
+    // 内联修饰符 (?i)：从这里到所在括号结束（或整个正则表达式结束）不区分
+    // 大小写；(?i:...) 只作用于括号内
+    if (input.compare(pos, 4, "(?i)") == 0) {
+        pos += 4;
+        ignoreCase = true;
+        return make_shared<EpsilonNode>();
+    }
+    bool scoped = input.compare(pos, 4, "(?i:") == 0;
+
     // 处理括号
     if (match('(')) {
+        bool outerIgnoreCase = ignoreCase;
+        if (scoped) {
+            pos += 3;
+            ignoreCase = true;
+        }
         auto node = parseUnion();
         if (!match(')')) {
             throw runtime_error("缺少右括号");
         }
+        ignoreCase = outerIgnoreCase;
         return node;
     }
 
@@ -123,7 +168,7 @@ shared_ptr<ASTNode> RegexParser::parseAtom() {
         case 'r':
             return make_shared<CharNode>('\r');
         default:
-            return make_shared<CharNode>(escaped);
+            return literal(escaped);
         }
     }
 
@@ -133,10 +178,10 @@ shared_ptr<ASTNode> RegexParser::parseAtom() {
     }
 
     // 处理单个字符
-    if (ch != '\0' && ch != '|' && ch != '(' && ch != ')' && ch != '*' &&
-        ch != '+' && ch != '?') {
+    if (ch != '\0' && ch != '|' && ch != '&' && ch != '(' && ch != ')' &&
+        ch != '*' && ch != '+' && ch != '?') {
         advance(); // 跳过当前字符
-        return make_shared<CharNode>(ch);
+        return literal(ch);
     }
 
     // 如果都不匹配，返回空串
@@ -198,5 +243,50 @@ shared_ptr<ASTNode> RegexParser::parseCharset() {
         }
     }
 
+    foldCharset(charset);
+    return charset;
+}
+
+shared_ptr<ASTNode> RegexParser::literal(char ch) {
+    if (!ignoreCase || !isalpha(static_cast<unsigned char>(ch))) {
+        return make_shared<CharNode>(ch);
+    }
+    // 大小写两种形式走同一条边，DFA的状态数与区分大小写时相同
+    auto charset = make_shared<CharsetNode>();
+    charset->chars.push_back(ch);
+    foldCharset(charset);
     return charset;
 }
+
+void RegexParser::foldCharset(shared_ptr<CharsetNode> charset) {
+    if (!ignoreCase) {
+        return;
+    }
+    // 只折叠ASCII字母；取反字符类折叠后再取反，[^a] 即不是 a 也不是 A
+    vector<char> &chars = charset->chars;
+    size_t count = chars.size();
+    for (size_t i = 0; i < count; i++) {
+        unsigned char ch = static_cast<unsigned char>(chars[i]);
+        if (ch >= 128 || !isalpha(ch)) {
+            continue;
+        }
+        char other = static_cast<char>(islower(ch) ? toupper(ch) : tolower(ch));
+        if (find(chars.begin(), chars.end(), other) == chars.end()) {
+            chars.push_back(other);
+        }
+    }
+}
+
+int RegexParser::parseCount() {
+    if (!isdigit(static_cast<unsigned char>(peek()))) {
+        throw runtime_error("重复次数必须是非负整数");
+    }
+    int count = 0;
+    while (isdigit(static_cast<unsigned char>(peek()))) {
+        count = count * 10 + (advance() - '0');
+        if (count > 100000) {
+            throw runtime_error("重复次数过大（最多 100000）");
+        }
+    }
+    return count;
+}
@@ -11,14 +11,23 @@ class RegexParser {
 
   private:
     string input;
-    size_t pos; // 当前解析位置
+    size_t pos;      // 当前解析位置
+    bool ignoreCase; // 当前是否处于 (?i) 的作用范围内
 
     // 递归下降解析
-    shared_ptr<ASTNode> parseUnion();   // 解析 |
-    shared_ptr<ASTNode> parseConcat();  // 解析连接
-    shared_ptr<ASTNode> parseRepeat();  // 解析 * + ?
-    shared_ptr<ASTNode> parseAtom();    // 解析原子（字符、字符类、括号）
-    shared_ptr<ASTNode> parseCharset(); // 解析 [...]
+    shared_ptr<ASTNode> parseUnion();     // 解析 |
+    shared_ptr<ASTNode> parseIntersect(); // 解析 &
+    shared_ptr<ASTNode> parseConcat();    // 解析连接
+    shared_ptr<ASTNode> parseRepeat();    // 解析 * + ? {m,n} 和前缀 ~
+    shared_ptr<ASTNode> parseAtom();      // 解析原子（字符、字符类、括号）
+    shared_ptr<ASTNode> parseCharset();   // 解析 [...]
+    int parseCount();                     // 解析 {m,n} 中的次数
+
+    // 单个字符的节点：不区分大小写时字母变为包含大小写两种形式的字符类
+    shared_ptr<ASTNode> literal(char ch);
+
+    // 不区分大小写时为字符类中的字母补上另一种大小写形式
+    void foldCharset(shared_ptr<CharsetNode> charset);
 
     char peek();        // 查看当前字符
     char advance();     // 前进一个字符
@@ -0,0 +1,203 @@
+#include "RegexSet.h"
+#include "Regex.h"
+#include <algorithm>
+
+using namespace std;
+
+const int RegexSet::UNKNOWN;
+
+RegexSet::RegexSet(const vector<string> &patterns, SetAnchor anchor)
+    : names(patterns), anchor(anchor), cacheLimit(DEFAULT_CACHE_LIMIT),
+      flushes(0) {
+    build(patterns);
+}
+
+RegexSet::RegexSet(const vector<LexerRule> &rules, SetAnchor anchor)
+    : anchor(anchor), cacheLimit(DEFAULT_CACHE_LIMIT), flushes(0) {
+    vector<string> patterns;
+    for (const LexerRule &rule : rules) {
+        names.push_back(rule.tokenType);
+        patterns.push_back(rule.regex);
+    }
+    build(patterns);
+}
+
+void RegexSet::build(const vector<string> &patterns) {
+    words = (patterns.size() + 63) / 64;
+    startBits.assign(words, 0);
+
+    // 1. 各模式分别编译，状态依次编号
+    for (size_t p = 0; p < patterns.size(); p++) {
+        FlatDFA dfa = Regex::compile(patterns[p]);
+        int offset = static_cast<int>(owner.size());
+        offsets.push_back(offset);
+        for (int t : dfa.transitions) {
+            transitions.push_back(t == -1 ? -1 : offset + t);
+        }
+        for (int q = 0; q < dfa.stateCount; q++) {
+            owner.push_back(static_cast<int>(p));
+            accepting.push_back(dfa.accepting[q]);
+        }
+        if (dfa.accepting[0]) {
+            startBits[p / 64] |= uint64_t(1) << (p % 64);
+        }
+    }
+
+    // 2. 所有起始状态在每个字节上的转换，非锚定匹配时每一步都要并入
+    for (int b = 0; b < 256; b++) {
+        for (int offset : offsets) {
+            int t = transitions[offset * 256 + b];
+            if (t != -1) {
+                startMoves[b].push_back(t);
+            }
+        }
+    }
+}
+
+int RegexSet::internMatchSet(const vector<uint64_t> &bits) const {
+    auto it = matchSetIds.find(bits);
+    if (it != matchSetIds.end()) {
+        return it->second;
+    }
+    int id = static_cast<int>(matchSets.size());
+    matchSets.push_back(bits);
+    matchSetIds[bits] = id;
+    return id;
+}
+
+int RegexSet::internState(const vector<int> &members) const {
+    auto it = cacheIds.find(members);
+    if (it != cacheIds.end()) {
+        return it->second;
+    }
+    if (cacheMembers.size() >= cacheLimit) {
+        cacheIds.clear();
+        cacheMembers.clear();
+        cacheMatch.clear();
+        cacheNext.clear();
+        flushes++;
+    }
+
+    // 接受位图：成员中接受状态所属的模式，非锚定时加上匹配空串的模式
+    vector<uint64_t> bits(words, 0);
+    if (anchor == SetAnchor::UNANCHORED) {
+        bits = startBits;
+    }
+    bool any = false;
+    for (size_t w = 0; w < words; w++) {
+        any = any || bits[w] != 0;
+    }
+    for (int g : members) {
+        if (accepting[g]) {
+            bits[owner[g] / 64] |= uint64_t(1) << (owner[g] % 64);
+            any = true;
+        }
+    }
+
+    int id = static_cast<int>(cacheMembers.size());
+    cacheIds[members] = id;
+    cacheMembers.push_back(members);
+    cacheMatch.push_back(any ? internMatchSet(bits) : -1);
+    cacheNext.resize(cacheNext.size() + 256, UNKNOWN);
+    return id;
+}
+
+int RegexSet::startState() const {
+    if (anchor == SetAnchor::UNANCHORED) {
+        // 起始状态隐含在每个组合状态中
+        return internState(vector<int>());
+    }
+    return internState(offsets);
+}
+
+int RegexSet::step(int state, unsigned char b) const {
+    int next = cacheNext[state * 256 + b];
+    if (next != UNKNOWN) {
+        return next;
+    }
+
+    vector<int> members;
+    for (int g : cacheMembers[state]) {
+        int t = transitions[g * 256 + b];
+        if (t != -1) {
+            members.push_back(t);
+        }
+    }
+    if (anchor == SetAnchor::UNANCHORED) {
+        members.insert(members.end(), startMoves[b].begin(),
+                       startMoves[b].end());
+    }
+    sort(members.begin(), members.end());
+    members.erase(unique(members.begin(), members.end()), members.end());
+
+    // 缓存被清空时 state 已经失效，只返回新状态，不记录转换
+    size_t generation = flushes;
+    next = internState(members);
+    if (generation == flushes) {
+        cacheNext[state * 256 + b] = next;
+    }
+    return next;
+}
+
+vector<int> RegexSet::match(const string &text) const {
+    return match(text.data(), text.data() + text.size());
+}
+
+vector<int> RegexSet::match(const char *begin, const char *end) const {
+    vector<uint64_t> found(words, 0);
+    int merged = -1; // 上一次并入 found 的位图，连续相同时不必重复合并
+    auto collect = [&](int matchSet) {
+        if (matchSet != -1 && matchSet != merged) {
+            const vector<uint64_t> &bits = matchSets[matchSet];
+            for (size_t w = 0; w < words; w++) {
+                found[w] |= bits[w];
+            }
+            merged = matchSet;
+        }
+    };
+
+    // 非锚定和前缀匹配时经过的每个接受状态都算数，整串匹配只看最后的状态
+    int state = startState();
+    bool everyPosition = anchor != SetAnchor::ANCHOR_BOTH;
+    if (everyPosition) {
+        collect(cacheMatch[state]);
+    }
+    for (const char *p = begin; p < end; p++) {
+        state = step(state, static_cast<unsigned char>(*p));
+        if (anchor != SetAnchor::UNANCHORED && cacheMembers[state].empty()) {
+            break; // 所有模式都已失败
+        }
+        if (everyPosition) {
+            collect(cacheMatch[state]);
+        }
+    }
+    if (!everyPosition) {
+        collect(cacheMatch[state]);
+    }
+
+    vector<int> ids;
+    for (size_t p = 0; p < names.size(); p++) {
+        if (found[p / 64] >> (p % 64) & 1) {
+            ids.push_back(static_cast<int>(p));
+        }
+    }
+    return ids;
+}
+
+bool RegexSet::matchAny(const char *begin, const char *end) const {
+    int state = startState();
+    bool everyPosition = anchor != SetAnchor::ANCHOR_BOTH;
+    if (everyPosition && cacheMatch[state] != -1) {
+        return true;
+    }
+    for (const char *p = begin; p < end; p++) {
+        state = step(state, static_cast<unsigned char>(*p));
+        if (anchor != SetAnchor::UNANCHORED && cacheMembers[state].empty()) {
+            return false;
+        }
+        if (everyPosition && cacheMatch[state] != -1) {
+            return true;
+        }
+    }
+    return cacheMatch[state] != -1;
+}
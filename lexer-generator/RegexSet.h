@@ -0,0 +1,97 @@
+#pragma once
+#include "DFA.h"
+#include "FileParser.h"
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// 匹配的锚定方式
+enum class SetAnchor {
+    UNANCHORED,   // 输入的任意子串匹配即可
+    ANCHOR_START, // 输入的某个前缀匹配（与词法分析器在当前位置的匹配相同）
+    ANCHOR_BOTH   // 整个输入匹配
+};
+
+// 多模式匹配：一次扫描输入，得到 N 个正则表达式中哪些匹配。
+// 每个模式先各自编译成最小化的扁平DFA，再把所有模式的DFA状态放入同一编号
+// 空间；组合自动机的状态是这些状态的集合，接受状态带有匹配的模式编号位图。
+// 模式多时组合DFA可能很大，因此在匹配时按需构造（惰性DFA）：每个组合状态的
+// 每个字节只在第一次经过时计算，结果缓存起来；缓存的状态数超过上限时整体
+// 清空重建。缓存在匹配时修改，一个对象不能同时被多个线程使用
+class RegexSet {
+  public:
+    RegexSet(const vector<string> &patterns,
+             SetAnchor anchor = SetAnchor::UNANCHORED);
+
+    // 模式取规则的正则表达式，名字取规则的记号类型（IGNORE 标记不起作用）
+    RegexSet(const vector<LexerRule> &rules,
+             SetAnchor anchor = SetAnchor::UNANCHORED);
+
+    size_t size() const { return names.size(); }
+
+    // 第 i 个模式的名字（记号类型，或由字符串构造时的正则表达式本身）
+    const string &getName(int i) const { return names[i]; }
+
+    // 匹配的模式编号，按从小到大排列
+    vector<int> match(const string &text) const;
+    vector<int> match(const char *begin, const char *end) const;
+
+    // 是否至少有一个模式匹配（找到第一个就返回）
+    bool matchAny(const char *begin, const char *end) const;
+
+    // 当前缓存的组合状态数
+    size_t getCachedStateCount() const { return cacheMembers.size(); }
+
+    // 缓存的组合状态数上限
+    void setCacheLimit(size_t limit) { cacheLimit = limit; }
+
+  private:
+    static const int UNKNOWN = -1; // 缓存中尚未计算的转换
+    static const size_t DEFAULT_CACHE_LIMIT = 10000;
+
+    vector<string> names;
+    SetAnchor anchor;
+    size_t words; // 位图的64位字数
+
+    // 所有模式的DFA状态统一编号：模式 p 的状态 q 编号为 offsets[p] + q
+    vector<int> offsets;
+    vector<int> transitions; // transitions[g * 256 + b]，-1 表示无转换
+    vector<int> owner;       // 状态所属的模式
+    vector<bool> accepting;
+
+    // 非锚定匹配时每个位置都隐含所有模式的起始状态，不放入集合：
+    // startMoves[b] 为所有起始状态读入 b 后的状态，startBits 为匹配空串的
+    // 模式的位图
+    vector<int> startMoves[256];
+    vector<uint64_t> startBits;
+
+    // 互不相同的接受位图，组合状态通过下标引用
+    mutable vector<vector<uint64_t>> matchSets;
+    mutable map<vector<uint64_t>, int> matchSetIds;
+
+    // 惰性DFA的缓存：组合状态 -> 编号、成员、接受位图编号（-1 表示不接受）
+    // 和转换
+    size_t cacheLimit;
+    mutable size_t flushes; // 缓存清空的次数
+    mutable map<vector<int>, int> cacheIds;
+    mutable vector<vector<int>> cacheMembers;
+    mutable vector<int> cacheMatch;
+    mutable vector<int> cacheNext;
+
+    void build(const vector<string> &patterns);
+
+    int internMatchSet(const vector<uint64_t> &bits) const;
+
+    // 组合状态的编号，不存在时加入缓存（缓存满时先清空）
+    int internState(const vector<int> &members) const;
+
+    // 初始组合状态
+    int startState() const;
+
+    // 组合状态 state 读入字节 b 后的状态
+    int step(int state, unsigned char b) const;
+};
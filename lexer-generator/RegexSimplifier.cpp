@@ -0,0 +1,345 @@
+#include "RegexSimplifier.h"
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+using namespace std;
+
+shared_ptr<ASTNode> RegexSimplifier::simplify(shared_ptr<ASTNode> ast) {
+    if (!ast) {
+        throw runtime_error("AST节点为空");
+    }
+
+    switch (ast->type) {
+    case NodeType::CHAR:
+    case NodeType::ANY:
+    case NodeType::EPSILON:
+        return ast;
+    case NodeType::CHARSET: {
+        // 空字符类等价于空串，只含一个字符的字符类化为单字符
+        bitset<256> chars;
+        if (!toCharSet(ast, chars)) {
+            return make_shared<EpsilonNode>();
+        }
+        return fromCharSet(chars);
+    }
+    case NodeType::CONCAT: {
+        vector<shared_ptr<ASTNode>> seq;
+        for (auto child : dynamic_pointer_cast<ConcatNode>(ast)->children) {
+            vector<shared_ptr<ASTNode>> part = toSequence(simplify(child));
+            seq.insert(seq.end(), part.begin(), part.end());
+        }
+        return fromSequence(seq, 0);
+    }
+    case NodeType::UNION: {
+        vector<shared_ptr<ASTNode>> alternatives;
+        collectAlternatives(ast, alternatives);
+        vector<vector<shared_ptr<ASTNode>>> sequences;
+        for (auto alternative : alternatives) {
+            sequences.push_back(toSequence(alternative));
+        }
+        vector<Suffix> suffixes;
+        for (const auto &seq : sequences) {
+            suffixes.push_back(Suffix{&seq, 0});
+        }
+        return buildUnion(suffixes);
+    }
+    case NodeType::STAR: {
+        auto child = simplify(dynamic_pointer_cast<StarNode>(ast)->child);
+        if (child->type == NodeType::EPSILON ||
+            child->type == NodeType::STAR) {
+            return child; // ε* = ε，(a*)* = a*
+        }
+        if (child->type == NodeType::PLUS) {
+            // (a+)* = a*
+            return make_shared<StarNode>(
+                dynamic_pointer_cast<PlusNode>(child)->child);
+        }
+        return make_shared<StarNode>(child);
+    }
+    case NodeType::PLUS: {
+        auto child = simplify(dynamic_pointer_cast<PlusNode>(ast)->child);
+        if (child->type == NodeType::EPSILON ||
+            child->type == NodeType::STAR || child->type == NodeType::PLUS) {
+            return child; // ε+ = ε，(a*)+ = a*，(a+)+ = a+
+        }
+        return make_shared<PlusNode>(child);
+    }
+    case NodeType::REPEAT: {
+        auto node = dynamic_pointer_cast<RepeatNode>(ast);
+        auto child = simplify(node->child);
+        if (node->max == 0 || child->type == NodeType::EPSILON) {
+            return make_shared<EpsilonNode>(); // a{0} = ε{m,n} = ε
+        }
+        if (node->min == 1 && node->max == 1) {
+            return child; // a{1} = a
+        }
+        if (node->max == -1 && node->min <= 1) {
+            // a{0,} = a*，a{1,} = a+
+            shared_ptr<ASTNode> closure;
+            if (node->min == 0) {
+                closure = make_shared<StarNode>(child);
+            } else {
+                closure = make_shared<PlusNode>(child);
+            }
+            return simplify(closure);
+        }
+        return make_shared<RepeatNode>(child, node->min, node->max);
+    }
+    case NodeType::INTERSECT: {
+        auto node = dynamic_pointer_cast<IntersectNode>(ast);
+        return make_shared<IntersectNode>(simplify(node->left),
+                                          simplify(node->right));
+    }
+    case NodeType::COMPLEMENT: {
+        auto child = simplify(dynamic_pointer_cast<ComplementNode>(ast)->child);
+        if (child->type == NodeType::COMPLEMENT) {
+            // ~~a = a
+            return dynamic_pointer_cast<ComplementNode>(child)->child;
+        }
+        return make_shared<ComplementNode>(child);
+    }
+    default:
+        throw runtime_error("未知的AST节点类型");
+    }
+}
+
+bool RegexSimplifier::toCharSet(shared_ptr<ASTNode> node, bitset<256> &chars) {
+    chars.reset();
+    switch (node->type) {
+    case NodeType::CHAR:
+        chars.set(static_cast<unsigned char>(
+            dynamic_pointer_cast<CharNode>(node)->ch));
+        return true;
+    case NodeType::ANY:
+        // 与Thompson构造一致：. 匹配除换行符和 '\0'（epsilon）外的所有字符
+        chars.set();
+        chars.reset('\n');
+        chars.reset(0);
+        return true;
+    case NodeType::CHARSET: {
+        auto charset = dynamic_pointer_cast<CharsetNode>(node);
+        for (char ch : charset->chars) {
+            chars.set(static_cast<unsigned char>(ch));
+        }
+        if (charset->negated) {
+            chars.flip();
+            chars.reset('\n');
+            chars.reset(0);
+            return true;
+        }
+        return !charset->chars.empty();
+    }
+    default:
+        return false;
+    }
+}
+
+shared_ptr<ASTNode> RegexSimplifier::fromCharSet(const bitset<256> &chars) {
+    if (chars.count() == 1) {
+        for (int i = 0; i < 256; i++) {
+            if (chars.test(i)) {
+                return make_shared<CharNode>(static_cast<char>(i));
+            }
+        }
+    }
+    auto charset = make_shared<CharsetNode>();
+    for (int i = 0; i < 256; i++) {
+        if (chars.test(i)) {
+            charset->chars.push_back(static_cast<char>(i));
+        }
+    }
+    return charset;
+}
+
+string RegexSimplifier::nodeKey(shared_ptr<ASTNode> node) {
+    // 单字符节点按字符集合编码：[a] 与 a、[^\n] 与 . 的键相同
+    if (node->type == NodeType::CHAR) {
+        return string("S1:") + dynamic_pointer_cast<CharNode>(node)->ch;
+    }
+    bitset<256> chars;
+    if (toCharSet(node, chars)) {
+        string key = "S" + to_string(chars.count()) + ":";
+        for (int i = 0; i < 256; i++) {
+            if (chars.test(i)) {
+                key += static_cast<char>(i);
+            }
+        }
+        return key;
+    }
+
+    switch (node->type) {
+    case NodeType::EPSILON:
+        return "E";
+    case NodeType::CONCAT:
+    case NodeType::UNION: {
+        const vector<shared_ptr<ASTNode>> &children =
+            node->type == NodeType::CONCAT
+                ? dynamic_pointer_cast<ConcatNode>(node)->children
+                : dynamic_pointer_cast<UnionNode>(node)->children;
+        string key = node->type == NodeType::CONCAT ? "C(" : "U(";
+        for (auto child : children) {
+            key += nodeKey(child) + ",";
+        }
+        return key + ")";
+    }
+    case NodeType::REPEAT: {
+        auto repeat = dynamic_pointer_cast<RepeatNode>(node);
+        return "R" + to_string(repeat->min) + "," + to_string(repeat->max) +
+               "(" + nodeKey(repeat->child) + ")";
+    }
+    case NodeType::INTERSECT: {
+        auto intersect = dynamic_pointer_cast<IntersectNode>(node);
+        return "I(" + nodeKey(intersect->left) + "," +
+               nodeKey(intersect->right) + ")";
+    }
+    case NodeType::COMPLEMENT:
+        return "N(" +
+               nodeKey(dynamic_pointer_cast<ComplementNode>(node)->child) +
+               ")";
+    case NodeType::STAR:
+        return "*(" + nodeKey(dynamic_pointer_cast<StarNode>(node)->child) +
+               ")";
+    case NodeType::PLUS:
+        return "+(" + nodeKey(dynamic_pointer_cast<PlusNode>(node)->child) +
+               ")";
+    default:
+        throw runtime_error("未知的AST节点类型");
+    }
+}
+
+vector<shared_ptr<ASTNode>>
+RegexSimplifier::toSequence(shared_ptr<ASTNode> node) {
+    vector<shared_ptr<ASTNode>> seq;
+    if (node->type == NodeType::EPSILON) {
+        return seq;
+    }
+    if (node->type == NodeType::CONCAT) {
+        for (auto child : dynamic_pointer_cast<ConcatNode>(node)->children) {
+            vector<shared_ptr<ASTNode>> part = toSequence(child);
+            seq.insert(seq.end(), part.begin(), part.end());
+        }
+        return seq;
+    }
+    seq.push_back(node);
+    return seq;
+}
+
+shared_ptr<ASTNode>
+RegexSimplifier::fromSequence(const vector<shared_ptr<ASTNode>> &seq,
+                              size_t begin) {
+    if (begin >= seq.size()) {
+        return make_shared<EpsilonNode>();
+    }
+    if (begin + 1 == seq.size()) {
+        return seq[begin];
+    }
+    return make_shared<ConcatNode>(
+        vector<shared_ptr<ASTNode>>(seq.begin() + begin, seq.end()));
+}
+
+void RegexSimplifier::collectAlternatives(
+    shared_ptr<ASTNode> node, vector<shared_ptr<ASTNode>> &alternatives) {
+    if (node->type == NodeType::UNION) {
+        for (auto child : dynamic_pointer_cast<UnionNode>(node)->children) {
+            collectAlternatives(child, alternatives);
+        }
+        return;
+    }
+    auto simplified = simplify(node);
+    if (simplified->type == NodeType::UNION) {
+        // 化简后的分支本身是并（如提取了公共前缀之外的部分），其分支已化简，
+        // 直接展开
+        auto nested = dynamic_pointer_cast<UnionNode>(simplified);
+        alternatives.insert(alternatives.end(), nested->children.begin(),
+                            nested->children.end());
+        return;
+    }
+    alternatives.push_back(simplified);
+}
+
+shared_ptr<ASTNode>
+RegexSimplifier::buildUnion(const vector<Suffix> &alternatives) {
+    // 1. 按首元素分组提取公共前缀：xA|xB -> x(A|B)，重复的分支在这里合并。
+    //    首元素按结构键分组，全是字面串的并（如关键字表）由此直接得到字典树，
+    //    分支数很多时仍是线性时间
+    bool hasEpsilon = false;
+    vector<Suffix> firsts;                // 每组的第一个分支
+    vector<vector<Suffix>> rests;         // 每组各分支去掉首元素后的部分
+    unordered_map<string, size_t> groups; // 首元素的键 -> 组
+    for (const Suffix &alternative : alternatives) {
+        const vector<shared_ptr<ASTNode>> &seq = *alternative.seq;
+        if (alternative.begin >= seq.size()) {
+            hasEpsilon = true;
+            continue;
+        }
+        auto inserted = groups.insert(
+            make_pair(nodeKey(seq[alternative.begin]), rests.size()));
+        if (inserted.second) {
+            firsts.push_back(alternative);
+            rests.emplace_back();
+        }
+        rests[inserted.first->second].push_back(
+            Suffix{alternative.seq, alternative.begin + 1});
+    }
+
+    vector<shared_ptr<ASTNode>> branches;
+    for (size_t g = 0; g < rests.size(); g++) {
+        const Suffix &first = firsts[g];
+        if (rests[g].size() == 1) {
+            branches.push_back(fromSequence(*first.seq, first.begin));
+        } else {
+            vector<shared_ptr<ASTNode>> seq;
+            seq.push_back((*first.seq)[first.begin]);
+            vector<shared_ptr<ASTNode>> rest = toSequence(buildUnion(rests[g]));
+            seq.insert(seq.end(), rest.begin(), rest.end());
+            branches.push_back(fromSequence(seq, 0));
+        }
+    }
+
+    // 2. 单字符分支合并为一个字符类
+    bitset<256> merged;
+    int charBranches = 0;
+    vector<shared_ptr<ASTNode>> others;
+    for (auto branch : branches) {
+        bitset<256> chars;
+        if (toCharSet(branch, chars)) {
+            merged |= chars;
+            charBranches++;
+        } else {
+            others.push_back(branch);
+        }
+    }
+    if (charBranches > 0) {
+        others.insert(others.begin(), fromCharSet(merged));
+    }
+
+    // 3. 空串分支：已有可空的闭包时多余，a+|ε 化为 a*，a{1,n}|ε 化为 a{0,n}
+    if (hasEpsilon) {
+        bool absorbed = false;
+        for (size_t i = 0; i < others.size() && !absorbed; i++) {
+            if (others[i]->type == NodeType::STAR) {
+                absorbed = true;
+            } else if (others[i]->type == NodeType::PLUS) {
+                others[i] = make_shared<StarNode>(
+                    dynamic_pointer_cast<PlusNode>(others[i])->child);
+                absorbed = true;
+            } else if (others[i]->type == NodeType::REPEAT) {
+                auto repeat = dynamic_pointer_cast<RepeatNode>(others[i]);
+                if (repeat->min <= 1) {
+                    others[i] = make_shared<RepeatNode>(repeat->child, 0,
+                                                        repeat->max);
+                    absorbed = true;
+                }
+            }
+        }
+        if (!absorbed) {
+            others.push_back(make_shared<EpsilonNode>());
+        }
+    }
+
+    if (others.size() == 1) {
+        return others[0];
+    }
+    return make_shared<UnionNode>(others);
+}
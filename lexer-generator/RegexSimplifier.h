@@ -0,0 +1,51 @@
+#pragma once
+#include "RegexAST.h"
+#include <bitset>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// 正则表达式AST化简：在Thompson构造之前缩小AST，使生成的NFA状态更少
+//   - 展开嵌套的连接和并，去掉连接中的空串
+//   - 并中的单字符、字符类和 . 合并为一个字符类，如 a|[bc]|d -> [a-d]
+//   - 提取并中各分支的公共前缀，如 int|if|in -> i(n(t|ε)|f)
+//   - 去掉重复的分支和多余的闭包，如 (a*)* -> a*、a+|ε -> a*
+//   - 计数重复的特殊情况化为闭包，如 a{0,} -> a*、a{1} -> a
+// 化简前后匹配的语言完全相同
+class RegexSimplifier {
+  public:
+    shared_ptr<ASTNode> simplify(shared_ptr<ASTNode> ast);
+
+  private:
+    // 节点匹配的字符集合；不是单字符节点时返回false
+    bool toCharSet(shared_ptr<ASTNode> node, bitset<256> &chars);
+
+    // 字符集合构造为节点：只有一个字符时为 CharNode
+    shared_ptr<ASTNode> fromCharSet(const bitset<256> &chars);
+
+    // 子树的结构键：两棵子树匹配方式相同（单字符节点比较字符集合）当且仅当
+    // 键相同
+    string nodeKey(shared_ptr<ASTNode> node);
+
+    // 把已化简的节点展开为连接序列（空串为空序列）
+    vector<shared_ptr<ASTNode>> toSequence(shared_ptr<ASTNode> node);
+
+    // 由连接序列构造左结合的连接树
+    shared_ptr<ASTNode> fromSequence(const vector<shared_ptr<ASTNode>> &seq,
+                                     size_t begin);
+
+    // 收集并的所有分支（已化简）
+    void collectAlternatives(shared_ptr<ASTNode> node,
+                             vector<shared_ptr<ASTNode>> &alternatives);
+
+    // 连接序列中从 begin 开始的部分，提取公共前缀时不必复制序列
+    struct Suffix {
+        const vector<shared_ptr<ASTNode>> *seq;
+        size_t begin;
+    };
+
+    // 化简一组分支的并：提取公共前缀、合并字符、去重
+    shared_ptr<ASTNode> buildUnion(const vector<Suffix> &alternatives);
+};
@@ -0,0 +1,209 @@
+#include "RuntimeLexer.h"
+#include "DFAMinimizer.h"
+#include "Derivative.h"
+#include "RegexParser.h"
+#include "RegexSimplifier.h"
+#include "SubsetConstruction.h"
+#include "Thompson.h"
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+RuntimeLexer::RuntimeLexer(const vector<LexerRule> &lexerRules, bool useJit)
+    : rules(lexerRules), jitEnabled(false), pos(0), line(1), column(1),
+      mode(0) {
+    RegexParser regexParser;
+    RegexSimplifier simplifier;
+    ThompsonConstruction thompson;
+    SubsetConstruction subset;
+    DFAMinimizer minimizer;
+    modes = FileParser::collectModes(rules);
+    firstByteRules.resize(modes.size() * 256);
+
+    for (size_t i = 0; i < rules.size(); i++) {
+        auto ast = regexParser.parse(rules[i].regex);
+        // 字面串的并（如关键字表）由字典树直接得到最小DFA，在化简（提取
+        // 公共前缀）之前判断
+        shared_ptr<DFA> dfa = ThompsonConstruction::buildLiteralDFA(ast);
+        if (!dfa) {
+            ast = simplifier.simplify(ast);
+        }
+        if (!dfa && DerivativeConstruction::needsDerivatives(ast)) {
+            // 交和补只有导数构造支持
+            DerivativeConstruction derivative;
+            dfa = minimizer.minimize(derivative.build(ast));
+        } else if (!dfa) {
+            dfa = minimizer.minimize(subset.convert(thompson.build(ast)));
+        }
+        dfas.push_back(FlatDFA::fromDFA(dfa));
+
+        for (size_t m = 0; m < modes.size(); m++) {
+            if (!rules[i].activeIn(modes[m])) {
+                continue;
+            }
+            for (int b = 0; b < 256; b++) {
+                if (dfas.back().transitions[b] != -1) {
+                    firstByteRules[m * 256 + b].push_back(static_cast<int>(i));
+                }
+            }
+        }
+
+        const FlatDFA &flat = dfas.back();
+        bool newline = false;
+        for (int q = 0; q < flat.stateCount; q++) {
+            newline = newline || flat.transitions[q * 256 + '\n'] != -1;
+        }
+        multiline.push_back(newline);
+        auto target = find(modes.begin(), modes.end(), rules[i].pushMode);
+        pushModes.push_back(rules[i].pushMode.empty()
+                                ? -1
+                                : static_cast<int>(target - modes.begin()));
+    }
+
+    if (useJit && DFAJit::isSupported()) {
+        jitEnabled = jit.compile(dfas);
+    }
+}
+
+vector<LexerRule> RuntimeLexer::loadRules(const string &filename) {
+    FileParser fileParser;
+    return fileParser.readLexerRules(filename);
+}
+
+void RuntimeLexer::reset(const string &input) {
+    text = input;
+    pos = 0;
+    line = 1;
+    column = 1;
+    mode = 0;
+    modeStack.clear();
+}
+
+size_t RuntimeLexer::getStateCount() const {
+    size_t count = 0;
+    for (const FlatDFA &dfa : dfas) {
+        count += dfa.stateCount;
+    }
+    return count;
+}
+
+int RuntimeLexer::matchRule(size_t index, size_t startPos) const {
+    const unsigned char *begin =
+        reinterpret_cast<const unsigned char *>(text.data()) + startPos;
+    const unsigned char *end =
+        reinterpret_cast<const unsigned char *>(text.data()) + text.length();
+    if (jitEnabled) {
+        return jit.function(index)(begin, end);
+    }
+    return dfas[index].match(begin, end);
+}
+
+void RuntimeLexer::advance(size_t index, size_t length) {
+    if (!multiline[index]) {
+        pos += length;
+        column += static_cast<int>(length);
+        return;
+    }
+    for (size_t end = pos + length; pos < end; pos++) {
+        if (text[pos] == '\n') {
+            line++;
+            column = 1;
+        } else {
+            column++;
+        }
+    }
+}
+
+void RuntimeLexer::applyModeAction(size_t index) {
+    if (rules[index].popMode) {
+        mode = modeStack.empty() ? 0 : modeStack.back();
+        if (!modeStack.empty()) {
+            modeStack.pop_back();
+        }
+    }
+    if (pushModes[index] != -1) {
+        modeStack.push_back(mode);
+        mode = pushModes[index];
+    }
+}
+
+Token *RuntimeLexer::nextToken() {
+    while (true) {
+        // 跳过空白字符（只在 INITIAL 模式中，其他模式中的空白由规则处理）
+        while (mode == 0 && pos < text.length() &&
+               (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' ||
+                text[pos] == '\r')) {
+            if (text[pos] == '\n') {
+                line++;
+                column = 1;
+            } else {
+                column++;
+            }
+            pos++;
+        }
+
+        if (pos >= text.length()) {
+            if (mode != 0) {
+                // 错误：输入在非 INITIAL 模式中结束（如未闭合的块注释）
+                throw runtime_error("Unexpected end of input in mode " +
+                                    modes[mode] + " at line " +
+                                    to_string(line) + ", column " +
+                                    to_string(column));
+            }
+            return nullptr;
+        }
+
+        // 按规则顺序尝试候选规则：IGNORE 规则匹配成功立即跳过，
+        // 其余规则取最长匹配，长度相同时先出现的规则优先
+        int longestLength = 0;
+        int matchedRule = -1;
+        bool ignored = false;
+        unsigned char first = static_cast<unsigned char>(text[pos]);
+        for (int i : firstByteRules[mode * 256 + first]) {
+            int length = matchRule(i, pos);
+            if (rules[i].ignore) {
+                if (length > 0) {
+                    advance(i, length);
+                    applyModeAction(i);
+                    ignored = true;
+                    break;
+                }
+            } else if (length > longestLength) {
+                longestLength = length;
+                matchedRule = i;
+            }
+        }
+        if (ignored) {
+            continue;
+        }
+
+        if (longestLength > 0) {
+            string value = text.substr(pos, longestLength);
+            Token *token =
+                new Token(rules[matchedRule].tokenType, value, line, column);
+            advance(matchedRule, longestLength);
+            applyModeAction(matchedRule);
+            return token;
+        }
+
+        // 错误：无法识别的字符
+        throw runtime_error("Unexpected character '" + string(1, text[pos]) +
+                            "' at line " + to_string(line) + ", column " +
+                            to_string(column));
+    }
+}
+
+vector<Token *> RuntimeLexer::tokenize(const string &input) {
+    reset(input);
+    vector<Token *> tokens;
+    while (true) {
+        Token *token = nextToken();
+        if (token) {
+            tokens.push_back(token);
+        } else {
+            break;
+        }
+    }
+    return tokens;
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "DFA.h"
+#include "DFAJit.h"
+#include "FileParser.h"
+#include <string>
+#include <vector>
+
+using namespace std;
+
+#ifndef TOKEN_DEFINED
+#define TOKEN_DEFINED
+struct Token {
+    string type;
+    string value;
+    int line;
+    int column;
+
+    Token(string t, string v, int l, int c)
+        : type(t), value(v), line(l), column(c) {}
+
+    string toString() const {
+        return "Token(" + type + ", " + value + ", " + to_string(line) + ", " +
+               to_string(column) + ")";
+    }
+};
+#endif
+
+// 运行时词法分析器：规则在运行时加载，不需要生成代码再编译。
+// 构造时对每条规则执行 正则解析 -> Thompson构造 -> 子集构造 -> 最小化，
+// 得到扁平化的DFA；x86-64 上默认把DFA JIT编译成机器码，
+// 其他平台或JIT失败时解释执行转换表。
+// 匹配语义与生成的词法分析器一致：INITIAL 模式中跳过空白、最长匹配、
+// 长度相同时先出现的规则优先、IGNORE 规则匹配成功即跳过，起始条件
+// （<MODE> 前缀和 PUSH/POP）的含义也相同，输入在其他模式中结束时报错。
+class RuntimeLexer {
+  public:
+    explicit RuntimeLexer(const vector<LexerRule> &rules, bool useJit = true);
+
+    // 从规则文件加载
+    static vector<LexerRule> loadRules(const string &filename);
+
+    // 是否正在使用JIT编译的匹配函数
+    bool isJitEnabled() const { return jitEnabled; }
+
+    // 设置新的输入并从头开始分析
+    void reset(const string &input);
+
+    Token *nextToken();
+    vector<Token *> tokenize(const string &input);
+
+    size_t getStateCount() const;
+    size_t getJitCodeSize() const { return jit.getCodeSize(); }
+
+  private:
+    vector<LexerRule> rules;
+    vector<FlatDFA> dfas;
+    DFAJit jit;
+    bool jitEnabled;
+
+    // 首字节候选规则：firstByteRules[mode * 256 + ch] 为模式 mode 中可能以
+    // 字节 ch 开头的规则下标
+    vector<vector<int>> firstByteRules;
+    vector<string> modes;   // 模式名，下标为模式编号，0 为 INITIAL
+    vector<int> pushModes;  // 规则 PUSH 的模式编号，-1 表示不切换
+    vector<bool> multiline; // 规则的匹配是否可能跨行
+
+    string text;
+    size_t pos;
+    int line;
+    int column;
+    int mode;              // 当前模式，0 为 INITIAL
+    vector<int> modeStack; // PUSH 时保存的模式
+
+    int matchRule(size_t index, size_t startPos) const;
+
+    // 前进 length 个字节，跨行的规则按其中的换行符更新行号和列号
+    void advance(size_t index, size_t length);
+
+    // 规则匹配后的模式切换：先 POP 再 PUSH
+    void applyModeAction(size_t index);
+};
@@ -0,0 +1,155 @@
+#include "SimdDFA.h"
+#include <algorithm>
+#include <thread>
+
+#if DFA_SIMD_AVAILABLE
+#include <tmmintrin.h>
+#endif
+
+using namespace std;
+
+bool SimdDFA::isSupported() {
+#if DFA_SIMD_AVAILABLE
+    return __builtin_cpu_supports("ssse3");
+#else
+    return false;
+#endif
+}
+
+bool SimdDFA::build(const FlatDFA &dfa) {
+    if (dfa.stateCount + 1 > MAX_STATES) {
+        return false;
+    }
+    stateCount = dfa.stateCount;
+    accepting = dfa.accepting;
+
+    // 没有转换时进入失败状态，失败状态和未使用的位置都停留在失败状态
+    table.assign(256 * MAX_STATES, static_cast<unsigned char>(deadState()));
+    for (int b = 0; b < 256; b++) {
+        for (int s = 0; s < stateCount; s++) {
+            int next = dfa.transitions[s * 256 + b];
+            if (next != -1) {
+                table[b * MAX_STATES + s] = static_cast<unsigned char>(next);
+            }
+        }
+    }
+    return true;
+}
+
+StateMap SimdDFA::identity() const {
+    StateMap map;
+    for (int s = 0; s < MAX_STATES; s++) {
+        map.to[s] = static_cast<unsigned char>(s);
+    }
+    return map;
+}
+
+StateMap SimdDFA::compose(const StateMap &first, const StateMap &second) {
+    StateMap map;
+    for (int s = 0; s < MAX_STATES; s++) {
+        map.to[s] = second.to[first.to[s]];
+    }
+    return map;
+}
+
+StateMap SimdDFA::run(const unsigned char *begin,
+                      const unsigned char *end) const {
+#if DFA_SIMD_AVAILABLE
+    static const bool ssse3 = isSupported();
+    if (ssse3) {
+        return runSsse3(begin, end);
+    }
+#endif
+    return runScalar(begin, end);
+}
+
+StateMap SimdDFA::runScalar(const unsigned char *begin,
+                            const unsigned char *end) const {
+    StateMap map = identity();
+    for (const unsigned char *p = begin; p < end; p++) {
+        const unsigned char *row = &table[*p * MAX_STATES];
+        for (int s = 0; s < MAX_STATES; s++) {
+            map.to[s] = row[map.to[s]];
+        }
+    }
+    return map;
+}
+
+#if DFA_SIMD_AVAILABLE
+// 复合 m' = T[b][m]：pshufb 以 m 的各字节为下标从转换向量中取值。转换向量的
+// 加载只依赖输入字节，循环中相互依赖的只有一条 pshufb
+__attribute__((target("ssse3"))) StateMap
+SimdDFA::runSsse3(const unsigned char *begin, const unsigned char *end) const {
+    StateMap map = identity();
+    const unsigned char *rows = table.data();
+    __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i *>(map.to));
+    const unsigned char *p = begin;
+    for (; p + 4 <= end; p += 4) {
+        m = _mm_shuffle_epi8(
+            _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(rows + p[0] * MAX_STATES)),
+            m);
+        m = _mm_shuffle_epi8(
+            _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(rows + p[1] * MAX_STATES)),
+            m);
+        m = _mm_shuffle_epi8(
+            _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(rows + p[2] * MAX_STATES)),
+            m);
+        m = _mm_shuffle_epi8(
+            _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(rows + p[3] * MAX_STATES)),
+            m);
+    }
+    for (; p < end; p++) {
+        m = _mm_shuffle_epi8(
+            _mm_loadu_si128(
+                reinterpret_cast<const __m128i *>(rows + *p * MAX_STATES)),
+            m);
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(map.to), m);
+    return map;
+}
+#endif
+
+vector<int> SimdDFA::chunkStates(const unsigned char *begin,
+                                 const unsigned char *end, size_t chunkCount,
+                                 unsigned threads) const {
+    chunkCount = max<size_t>(chunkCount, 1);
+    size_t length = static_cast<size_t>(end - begin);
+    auto chunkBegin = [&](size_t i) { return begin + length * i / chunkCount; };
+
+    // 1. 各段独立计算映射，段之间没有依赖
+    vector<StateMap> maps(chunkCount);
+    size_t workers = min<size_t>(max(threads, 1u), chunkCount);
+    auto worker = [&](size_t w) {
+        for (size_t i = w; i < chunkCount; i += workers) {
+            maps[i] = run(chunkBegin(i), chunkBegin(i + 1));
+        }
+    };
+    vector<thread> pool;
+    for (size_t w = 1; w < workers; w++) {
+        pool.push_back(thread(worker, w));
+    }
+    worker(0);
+    for (auto &t : pool) {
+        t.join();
+    }
+
+    // 2. 从起始状态0出发按顺序拼接
+    vector<int> states;
+    int state = 0;
+    for (size_t i = 0; i < chunkCount; i++) {
+        states.push_back(state == deadState() ? -1 : state);
+        state = maps[i].to[state];
+    }
+    states.push_back(state == deadState() ? -1 : state);
+    return states;
+}
+
+bool SimdDFA::accepts(const unsigned char *begin,
+                      const unsigned char *end) const {
+    int state = run(begin, end).to[0];
+    return state != deadState() && accepting[state];
+}
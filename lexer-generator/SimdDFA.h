@@ -0,0 +1,73 @@
+#pragma once
+#include "DFA.h"
+#include <cstddef>
+#include <vector>
+
+using namespace std;
+
+// 在 x86（GCC/Clang）上编译 SSSE3 版本，运行时再检测CPU是否支持
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define DFA_SIMD_AVAILABLE 1
+#else
+#define DFA_SIMD_AVAILABLE 0
+#endif
+
+// 状态映射：to[s] 为从状态 s 出发读完一段输入后所在的状态
+struct StateMap {
+    unsigned char to[16];
+};
+
+// 小DFA的数据并行执行：状态数（加上一个失败状态）不超过16时，把“每个可能
+// 的起始状态 -> 当前状态”的映射放在一个16字节向量中，每读一个字节用一条
+// pshufb 与该字节的转换向量复合。复合不依赖实际的起始状态，因此可以把一大块
+// 输入切成若干段，各段独立（可在不同线程上）计算映射，最后按顺序拼接出每段
+// 开头的真实状态
+class SimdDFA {
+  public:
+    static const int MAX_STATES = 16; // 含失败状态
+
+    SimdDFA() : stateCount(0) {}
+
+    // 当前CPU是否支持 SSSE3；不支持时 run 退化为逐个状态查表，结果相同
+    static bool isSupported();
+
+    // 由扁平化的DFA构造，状态数超过 MAX_STATES - 1 时返回 false
+    bool build(const FlatDFA &dfa);
+
+    int getStateCount() const { return stateCount; }
+
+    // 失败状态（没有转换之后停留的状态）的编号
+    int deadState() const { return stateCount; }
+
+    // 恒等映射：每个状态映射到自身
+    StateMap identity() const;
+
+    // 从恒等映射出发读完 [begin, end) 后的状态映射
+    StateMap run(const unsigned char *begin, const unsigned char *end) const;
+
+    // 先读 first 对应的输入再读 second 对应的输入得到的映射
+    static StateMap compose(const StateMap &first, const StateMap &second);
+
+    // 把 [begin, end) 等分为 chunkCount 段，用 threads 个线程分别计算各段的
+    // 映射后拼接。返回 chunkCount + 1 个状态：第 i 个为从起始状态0出发读到
+    // 第 i 段开头时的状态，最后一个为读完全部输入后的状态；-1 表示已失败
+    vector<int> chunkStates(const unsigned char *begin,
+                            const unsigned char *end, size_t chunkCount,
+                            unsigned threads = 1) const;
+
+    // 整段输入是否被DFA完整接受
+    bool accepts(const unsigned char *begin, const unsigned char *end) const;
+
+  private:
+    int stateCount;
+    vector<bool> accepting;
+    // table[b * 16 + s]：状态 s 读入字节 b 后的状态，即字节 b 的转换向量
+    vector<unsigned char> table;
+
+    StateMap runScalar(const unsigned char *begin,
+                       const unsigned char *end) const;
+#if DFA_SIMD_AVAILABLE
+    StateMap runSsse3(const unsigned char *begin,
+                      const unsigned char *end) const;
+#endif
+};
@@ -1,19 +1,25 @@
 #include "SubsetConstruction.h"
-#include <queue>
+#include <algorithm>
+#include <atomic>
 #include <stdexcept>
+#include <thread>
 
 using namespace std;
 
+SubsetConstruction::SubsetConstruction(unsigned threads)
+    : threadCount(threads) {
+    if (threadCount == 0) {
+        threadCount = max(1u, thread::hardware_concurrency());
+    }
+}
+
 shared_ptr<DFA> SubsetConstruction::convert(shared_ptr<NFA> nfa) {
     if (!nfa) {
         throw runtime_error("NFA为空");
     }
 
-    // 收集所有输入字符（字母表）
-    set<char> alphabet = collectAlphabet(nfa);
-
     // 创建DFA状态映射：NFA状态集合 -> DFA状态
-    map<set<shared_ptr<NFAState>>, shared_ptr<DFAState>> stateMap;
+    StateMap stateMap;
 
     // 创建DFA状态ID计数器
     int dfaStateId = 0;
@@ -22,7 +28,8 @@ shared_ptr<DFA> SubsetConstruction::convert(shared_ptr<NFA> nfa) {
     set<shared_ptr<NFAState>> initialNfaStates;
     initialNfaStates.insert(nfa->start);
     set<shared_ptr<NFAState>> initialClosure =
-        nfa->epsilonClosure(initialNfaStates);
+        nfa->epsilonFree ? initialNfaStates
+                         : nfa->epsilonClosure(initialNfaStates);
 
     // 创建初始DFA状态
     auto initialDfaState = make_shared<DFAState>(dfaStateId++);
@@ -32,88 +39,126 @@ shared_ptr<DFA> SubsetConstruction::convert(shared_ptr<NFA> nfa) {
     // 创建DFA
     auto dfa = make_shared<DFA>(initialDfaState);
 
-    // 未处理的DFA状态队列
-    queue<shared_ptr<DFAState>> unprocessed;
-    unprocessed.push(initialDfaState);
-
-    // 处理所有未处理的DFA状态
-    while (!unprocessed.empty()) {
-        auto currentDfaState = unprocessed.front();
-        unprocessed.pop();
-
-        // 检查是否为接受状态：如果包含的NFA状态中有接受状态，则该DFA状态为接受状态
-        for (auto nfaState : currentDfaState->nfaStates) {
-            if (nfaState->isAccepting) {
-                currentDfaState->isAccepting = true;
-                break;
-            }
-        }
-
-        // 对每个输入字符计算转换
-        for (char c : alphabet) {
-            // 计算move操作
-            set<shared_ptr<NFAState>> moveResult =
-                move(currentDfaState->nfaStates, c);
-
-            if (!moveResult.empty()) {
-                // 计算epsilon闭包
-                set<shared_ptr<NFAState>> closure =
-                    nfa->epsilonClosure(moveResult);
-
-                // 检查这个NFA状态集合是否已经有对应的DFA状态
-                shared_ptr<DFAState> targetDfaState;
-                if (stateMap.find(closure) != stateMap.end()) {
-                    // 已存在，使用已有的DFA状态
-                    targetDfaState = stateMap[closure];
-                } else {
-                    // 不存在，创建新的DFA状态
-                    targetDfaState = make_shared<DFAState>(dfaStateId++);
-                    targetDfaState->nfaStates = closure;
-                    stateMap[closure] = targetDfaState;
-                    dfa->addState(targetDfaState);
-                    unprocessed.push(targetDfaState);
+    // 按层处理：frontier 是上一层新建、尚未处理的DFA状态。同一层的状态
+    // 互不依赖，可以并行展开；新状态按 (所在层状态的顺序, 字符) 依次编号，
+    // 与逐个出队处理的广度优先顺序完全相同，编号不受线程数影响
+    vector<shared_ptr<DFAState>> frontier(1, initialDfaState);
+    while (!frontier.empty()) {
+        // 1. 并行展开：各线程计算move和epsilon闭包，并在上一层之前的
+        //    stateMap 中查找已有状态（这一阶段 stateMap 只读）
+        vector<Expansion> expansions(frontier.size());
+        forEach(frontier.size(), [&](size_t i) {
+            expansions[i] = expand(nfa, frontier[i], stateMap);
+        });
+
+        // 2. 按顺序合并：为仍未找到的闭包创建新状态并添加转换。同一层的
+        //    多个状态可能到达同一个新闭包，所以这里要再查一次
+        vector<shared_ptr<DFAState>> next;
+        for (size_t i = 0; i < frontier.size(); i++) {
+            Expansion &expansion = expansions[i];
+            frontier[i]->isAccepting = expansion.accepting;
+            for (auto &target : expansion.targets) {
+                shared_ptr<DFAState> targetDfaState = target.existing;
+                if (!targetDfaState) {
+                    auto found = stateMap.find(target.closure);
+                    if (found != stateMap.end()) {
+                        targetDfaState = found->second;
+                    } else {
+                        targetDfaState = make_shared<DFAState>(dfaStateId++);
+                        targetDfaState->nfaStates = target.closure;
+                        stateMap[target.closure] = targetDfaState;
+                        dfa->addState(targetDfaState);
+                        next.push_back(targetDfaState);
+                    }
                 }
 
                 // 添加转换
-                currentDfaState->addTransition(c, targetDfaState);
+                frontier[i]->addTransition(target.symbol, targetDfaState);
             }
         }
+        frontier.swap(next);
     }
 
     return dfa;
 }
 
-set<shared_ptr<NFAState>>
-SubsetConstruction::move(const set<shared_ptr<NFAState>> &states, char c) {
-    set<shared_ptr<NFAState>> result;
-
-    // 从状态集合中的每个状态，通过字符c能到达的状态
-    for (auto state : states) {
-        if (state->transitions.find(c) != state->transitions.end()) {
-            for (auto nextState : state->transitions[c]) {
-                result.insert(nextState);
-            }
+SubsetConstruction::Expansion
+SubsetConstruction::expand(shared_ptr<NFA> nfa, shared_ptr<DFAState> state,
+                           const StateMap &stateMap) {
+    Expansion expansion;
+
+    // 检查是否为接受状态：如果包含的NFA状态中有接受状态，则该DFA状态为接受状态
+    expansion.accepting = false;
+    for (auto nfaState : state->nfaStates) {
+        if (nfaState->isAccepting) {
+            expansion.accepting = true;
+            break;
         }
     }
 
-    return result;
+    // 一次遍历各NFA状态的出边，按字符分组得到所有move结果；只访问
+    // 实际出现的字符，字母表很大而每个状态出边很少时（如字典树）更快
+    map<char, set<shared_ptr<NFAState>>> moves = moveAll(state->nfaStates);
+    for (auto &pair : moves) {
+        Target target;
+        target.symbol = pair.first;
+        // 计算epsilon闭包（无epsilon转换的NFA不需要）
+        target.closure = nfa->epsilonFree ? pair.second
+                                          : nfa->epsilonClosure(pair.second);
+        auto found = stateMap.find(target.closure);
+        if (found != stateMap.end()) {
+            target.existing = found->second;
+        }
+        expansion.targets.push_back(target);
+    }
+    return expansion;
 }
 
-set<char> SubsetConstruction::collectAlphabet(shared_ptr<NFA> nfa) {
-    set<char> alphabet;
+void SubsetConstruction::forEach(size_t count,
+                                 const function<void(size_t)> &body) {
+    // 任务太少时不值得创建线程
+    size_t workers = min<size_t>(threadCount, count / minBatch);
+    if (workers <= 1) {
+        for (size_t i = 0; i < count; i++) {
+            body(i);
+        }
+        return;
+    }
 
-    // 获取所有NFA状态
-    set<shared_ptr<NFAState>> allStates = nfa->getAllStates();
+    // 各线程每次领取一小段连续的下标，负载不均时自动平衡
+    atomic<size_t> nextIndex(0);
+    auto worker = [&]() {
+        for (;;) {
+            size_t begin = nextIndex.fetch_add(chunkSize);
+            if (begin >= count) {
+                return;
+            }
+            size_t end = min(count, begin + chunkSize);
+            for (size_t i = begin; i < end; i++) {
+                body(i);
+            }
+        }
+    };
+    vector<thread> threads;
+    for (size_t t = 1; t < workers; t++) {
+        threads.push_back(thread(worker));
+    }
+    worker();
+    for (auto &t : threads) {
+        t.join();
+    }
+}
 
-    // 收集所有转换中的字符（排除epsilon）
-    for (auto state : allStates) {
+map<char, set<shared_ptr<NFAState>>>
+SubsetConstruction::moveAll(const set<shared_ptr<NFAState>> &states) {
+    map<char, set<shared_ptr<NFAState>>> result;
+    for (auto state : states) {
         for (auto &pair : state->transitions) {
-            char ch = pair.first;
-            if (ch != '\0') { // 排除epsilon
-                alphabet.insert(ch);
+            if (pair.first != '\0') { // 排除epsilon
+                result[pair.first].insert(pair.second.begin(),
+                                          pair.second.end());
             }
         }
     }
-
-    return alphabet;
+    return result;
 }
@@ -1,22 +1,56 @@
 #pragma once
 #include "DFA.h"
 #include "NFA.h"
+#include <functional>
+#include <map>
 #include <memory>
 #include <set>
+#include <vector>
 
 using namespace std;
 
 // 子集构造算法：将NFA转换为DFA
+// 按广度优先的层展开DFA状态。threads 大于1时同一层的状态由多个线程并行
+// 计算move和epsilon闭包，再按顺序合并；无论线程数多少，得到的DFA（包括
+// 状态编号）都完全相同
 class SubsetConstruction {
   public:
+    // threads：工作线程数，0 表示使用硬件线程数
+    explicit SubsetConstruction(unsigned threads = 1);
+
     // 将NFA转换为DFA
     shared_ptr<DFA> convert(shared_ptr<NFA> nfa);
 
   private:
-    // 计算move操作：从状态集合通过字符c能到达的状态
-    set<shared_ptr<NFAState>> move(const set<shared_ptr<NFAState>> &states,
-                                   char c);
+    // NFA状态集合 -> DFA状态
+    typedef map<set<shared_ptr<NFAState>>, shared_ptr<DFAState>> StateMap;
+
+    static const size_t minBatch = 64;  // 每个线程至少分到的状态数
+    static const size_t chunkSize = 16; // 线程每次领取的状态数
+
+    // 一个字符上的转换目标
+    struct Target {
+        char symbol;
+        set<shared_ptr<NFAState>> closure; // move结果的epsilon闭包
+        shared_ptr<DFAState> existing;     // 展开前已存在的对应DFA状态
+    };
+
+    // 一个DFA状态的展开结果
+    struct Expansion {
+        bool accepting;
+        vector<Target> targets; // 按字符排列
+    };
+
+    unsigned threadCount;
+
+    // 展开一个DFA状态，只读访问 stateMap
+    Expansion expand(shared_ptr<NFA> nfa, shared_ptr<DFAState> state,
+                     const StateMap &stateMap);
+
+    // 对 [0, count) 中的每个下标调用 body，按 threadCount 并行
+    void forEach(size_t count, const function<void(size_t)> &body);
 
-    // 收集NFA中所有可能的输入字符（排除epsilon）
-    set<char> collectAlphabet(shared_ptr<NFA> nfa);
+    // 计算所有字符上的move操作：从状态集合通过各字符能到达的状态
+    map<char, set<shared_ptr<NFAState>>>
+    moveAll(const set<shared_ptr<NFAState>> &states);
 };
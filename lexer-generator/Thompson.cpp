@@ -1,6 +1,9 @@
 #include "Thompson.h"
+#include <algorithm>
+#include <map>
 #include <set>
 #include <stdexcept>
+#include <unordered_map>
 
 using namespace std;
 
@@ -35,6 +38,10 @@ shared_ptr<NFA> ThompsonConstruction::build(shared_ptr<ASTNode> ast) {
         auto plusNode = dynamic_pointer_cast<PlusNode>(ast);
         return buildPlus(plusNode);
     }
+    case NodeType::REPEAT: {
+        auto repeatNode = dynamic_pointer_cast<RepeatNode>(ast);
+        return buildRepeat(repeatNode);
+    }
     case NodeType::ANY: {
         auto anyNode = dynamic_pointer_cast<AnyNode>(ast);
         return buildAny(anyNode);
@@ -43,6 +50,10 @@ shared_ptr<NFA> ThompsonConstruction::build(shared_ptr<ASTNode> ast) {
         auto epsilonNode = dynamic_pointer_cast<EpsilonNode>(ast);
         return buildEpsilon(epsilonNode);
     }
+    case NodeType::INTERSECT:
+    case NodeType::COMPLEMENT:
+        throw runtime_error(
+            "Thompson构造不支持交（&）和补（~），请使用导数构造");
     default:
         throw runtime_error("未知的AST节点类型");
     }
@@ -65,9 +76,10 @@ ThompsonConstruction::buildCharset(shared_ptr<CharsetNode> node) {
     auto accept = make_shared<NFAState>(getNextStateId());
 
     if (node->negated) {
-        // 取反字符类 [^...]：匹配所有不在 chars 中的字符（除了换行符）
+        // 取反字符类 [^...]：匹配所有不在 chars 中的字符（除了换行符）。
+        // '\0' 在NFA中表示epsilon，不在集合内，否则字符类也会匹配空串
         set<char> excludedChars(node->chars.begin(), node->chars.end());
-        for (int i = 0; i < 256; i++) {
+        for (int i = 1; i < 256; i++) {
             char ch = static_cast<char>(i);
             if (ch != '\n' && excludedChars.find(ch) == excludedChars.end()) {
                 start->addTransition(ch, accept);
@@ -89,40 +101,198 @@ ThompsonConstruction::buildCharset(shared_ptr<CharsetNode> node) {
     return make_shared<NFA>(start, accept);
 }
 
-// 连接的NFA：NFA1 · NFA2
-shared_ptr<NFA> ThompsonConstruction::buildConcat(shared_ptr<ConcatNode> node) {
-    auto leftNFA = build(node->left);
-    auto rightNFA = build(node->right);
+// 把片段的起始状态并入 target：复制起始状态的所有出边。
+// Thompson片段的起始状态没有入边、接受状态没有出边，所以合并不改变语言
+static void mergeStart(shared_ptr<NFAState> target, shared_ptr<NFA> fragment) {
+    for (auto &pair : fragment->start->transitions) {
+        for (auto state : pair.second) {
+            target->transitions[pair.first].push_back(state);
+        }
+    }
+}
 
-    // 将leftNFA的接受状态连接到rightNFA的起始状态
-    leftNFA->accept->addEpsilonTransition(rightNFA->start);
-    leftNFA->accept->isAccepting = false;
+// 连接的NFA：NFA1 · NFA2 · ... · NFAn
+shared_ptr<NFA> ThompsonConstruction::buildConcat(shared_ptr<ConcatNode> node) {
+    auto first = build(node->children[0]);
+    auto accept = first->accept;
+
+    // 依次将后一个片段的起始状态并入前一个片段的接受状态，省去epsilon边和状态
+    for (size_t i = 1; i < node->children.size(); i++) {
+        auto next = build(node->children[i]);
+        mergeStart(accept, next);
+        accept->isAccepting = false;
+        accept = next->accept;
+    }
 
-    return make_shared<NFA>(leftNFA->start, rightNFA->accept);
+    return make_shared<NFA>(first->start, accept);
 }
 
-// 并的NFA：NFA1 | NFA2
+// 并的NFA：NFA1 | NFA2 | ... | NFAn
 shared_ptr<NFA> ThompsonConstruction::buildUnion(shared_ptr<UnionNode> node) {
-    auto leftNFA = build(node->left);
-    auto rightNFA = build(node->right);
+    // 全部是字面串的并（如关键字表）直接构造为字典树
+    vector<string> words;
+    if (literalUnion(node, words)) {
+        return buildLiteralTrie(words);
+    }
 
-    // 创建新的起始和接受状态
     auto newStart = make_shared<NFAState>(getNextStateId());
     auto newAccept = make_shared<NFAState>(getNextStateId());
 
-    // 从新起始状态通过epsilon转换到两个NFA的起始状态
-    newStart->addEpsilonTransition(leftNFA->start);
-    newStart->addEpsilonTransition(rightNFA->start);
-
-    // 从两个NFA的接受状态通过epsilon转换到新接受状态
-    leftNFA->accept->addEpsilonTransition(newAccept);
-    rightNFA->accept->addEpsilonTransition(newAccept);
-    leftNFA->accept->isAccepting = false;
-    rightNFA->accept->isAccepting = false;
+    // 各分支的起始状态并入新起始状态（同连接），只有离开分支时需要epsilon边
+    for (auto child : node->children) {
+        auto childNFA = build(child);
+        mergeStart(newStart, childNFA);
+        childNFA->accept->addEpsilonTransition(newAccept);
+        childNFA->accept->isAccepting = false;
+    }
 
     return make_shared<NFA>(newStart, newAccept);
 }
 
+bool ThompsonConstruction::literalUnion(shared_ptr<UnionNode> node,
+                                        vector<string> &words) {
+    words.clear();
+    for (auto child : node->children) {
+        string word;
+        if (!literalString(child, word)) {
+            return false;
+        }
+        words.push_back(word);
+    }
+    return true;
+}
+
+bool ThompsonConstruction::literalString(shared_ptr<ASTNode> node,
+                                         string &word) {
+    word.clear();
+    if (node->type == NodeType::EPSILON) {
+        return true;
+    }
+    if (node->type == NodeType::CHAR) {
+        word += dynamic_pointer_cast<CharNode>(node)->ch;
+        return word[0] != '\0'; // '\0' 在NFA中表示epsilon
+    }
+    if (node->type != NodeType::CONCAT) {
+        return false;
+    }
+    for (auto child : dynamic_pointer_cast<ConcatNode>(node)->children) {
+        if (child->type != NodeType::CHAR ||
+            dynamic_pointer_cast<CharNode>(child)->ch == '\0') {
+            return false;
+        }
+        word += dynamic_pointer_cast<CharNode>(child)->ch;
+    }
+    return true;
+}
+
+void ThompsonConstruction::buildTrie(vector<string> words,
+                                     vector<vector<pair<char, int>>> &trie,
+                                     vector<bool> &isEnd) {
+    // 排序后相邻的串共用最长公共前缀，新串只在上一个串的路径上分叉，
+    // 每个结点的子结点按字符顺序追加，不需要查找
+    sort(words.begin(), words.end());
+    trie.assign(1, vector<pair<char, int>>());
+    isEnd.assign(1, false);
+    vector<int> path(1, 0); // 上一个串经过的结点，path[k] 在深度 k
+    const string *previous = nullptr;
+    for (const string &word : words) {
+        size_t common = 0;
+        if (previous) {
+            while (common < previous->size() && common < word.size() &&
+                   (*previous)[common] == word[common]) {
+                common++;
+            }
+        }
+        path.resize(common + 1);
+        for (size_t k = common; k < word.size(); k++) {
+            int child = static_cast<int>(trie.size());
+            trie[path.back()].push_back(make_pair(word[k], child));
+            trie.emplace_back();
+            isEnd.push_back(false);
+            path.push_back(child);
+        }
+        isEnd[path.back()] = true;
+        previous = &word;
+    }
+}
+
+// 字面串集合的字典树NFA：公共前缀共用状态，每个字符一条转换。
+// 在叶结点结束的串直接转换到接受状态，在中间结点结束的串加一条epsilon边
+shared_ptr<NFA>
+ThompsonConstruction::buildLiteralTrie(const vector<string> &words) {
+    vector<vector<pair<char, int>>> trie;
+    vector<bool> isEnd;
+    buildTrie(words, trie, isEnd);
+
+    auto accept = make_shared<NFAState>(getNextStateId());
+    vector<shared_ptr<NFAState>> states(trie.size());
+    for (size_t i = 0; i < trie.size(); i++) {
+        bool leaf = i > 0 && trie[i].empty();
+        states[i] = leaf ? accept : make_shared<NFAState>(getNextStateId());
+    }
+    for (size_t i = 0; i < trie.size(); i++) {
+        for (const auto &child : trie[i]) {
+            states[i]->addTransition(child.first, states[child.second]);
+        }
+        if (isEnd[i] && states[i] != accept) {
+            states[i]->addEpsilonTransition(accept);
+        }
+    }
+
+    return make_shared<NFA>(states[0], accept);
+}
+
+// 字面串集合的最小DFA：字典树本身就是DFA，且没有环，两个结点等价当且仅当
+// 接受性相同且每个字符都转到等价的结点。子结点编号大于父结点，从后往前
+// 处理时子结点的等价类都已确定，按（接受性，各转换的字符和目标类）查表
+// 合并即可（Revuz 算法），时间与字典树大小成线性（忽略查表的对数因子）
+shared_ptr<DFA>
+ThompsonConstruction::buildLiteralDFA(shared_ptr<ASTNode> ast) {
+    vector<string> words;
+    if (ast->type != NodeType::UNION ||
+        !literalUnion(dynamic_pointer_cast<UnionNode>(ast), words)) {
+        return nullptr;
+    }
+    vector<vector<pair<char, int>>> trie;
+    vector<bool> isEnd;
+    buildTrie(words, trie, isEnd);
+
+    unordered_map<string, int> classes; // 签名 -> 等价类
+    vector<int> classOf(trie.size());
+    vector<int> representative; // 每个等价类的一个字典树结点
+    string signature;
+    for (size_t i = trie.size(); i-- > 0;) {
+        signature.assign(1, isEnd[i] ? 'A' : 'N');
+        for (const auto &child : trie[i]) {
+            signature += child.first;
+            signature += to_string(classOf[child.second]);
+            signature += ',';
+        }
+        auto it = classes.find(signature);
+        if (it == classes.end()) {
+            int id = static_cast<int>(representative.size());
+            it = classes.insert(make_pair(signature, id)).first;
+            representative.push_back(static_cast<int>(i));
+        }
+        classOf[i] = it->second;
+    }
+
+    vector<shared_ptr<DFAState>> states;
+    for (size_t c = 0; c < representative.size(); c++) {
+        states.push_back(make_shared<DFAState>(static_cast<int>(c)));
+        states.back()->isAccepting = isEnd[representative[c]];
+    }
+    auto dfa = make_shared<DFA>(states[classOf[0]]);
+    for (size_t c = 0; c < representative.size(); c++) {
+        for (const auto &child : trie[representative[c]]) {
+            states[c]->addTransition(child.first,
+                                     states[classOf[child.second]]);
+        }
+        dfa->addState(states[c]);
+    }
+    return dfa;
+}
+
 // Kleene闭包的NFA：NFA*
 shared_ptr<NFA> ThompsonConstruction::buildStar(shared_ptr<StarNode> node) {
     auto childNFA = build(node->child);
@@ -164,13 +334,79 @@ shared_ptr<NFA> ThompsonConstruction::buildPlus(shared_ptr<PlusNode> node) {
     return make_shared<NFA>(newStart, newAccept);
 }
 
+// 计数重复的NFA：NFA{m,n}
+// 子表达式只构建一次作为模板，每个副本复制模板片段，不再重复遍历AST。
+// 必需的 m 个副本直接连接；可选的 n-m 个副本嵌套为 (r(r(r)?)?)?，
+// 每个副本的接受状态都有一条epsilon边到新接受状态；无上限时最后接一个闭包
+shared_ptr<NFA> ThompsonConstruction::buildRepeat(shared_ptr<RepeatNode> node) {
+    auto pattern = build(node->child);
+
+    auto start = make_shared<NFAState>(getNextStateId());
+    auto newAccept = make_shared<NFAState>(getNextStateId());
+    auto current = start; // 已构建部分的末尾状态
+
+    // 必需部分：把副本的起始状态并入当前末尾状态（同 buildConcat）
+    for (int i = 0; i < node->min; i++) {
+        auto copy = cloneFragment(pattern);
+        for (auto &pair : copy->start->transitions) {
+            for (auto target : pair.second) {
+                current->transitions[pair.first].push_back(target);
+            }
+        }
+        copy->accept->isAccepting = false;
+        current = copy->accept;
+    }
+
+    if (node->max == -1) {
+        // 无上限：末尾接一个闭包
+        auto copy = cloneFragment(pattern);
+        current->addEpsilonTransition(copy->start);
+        copy->accept->addEpsilonTransition(copy->start);
+        copy->accept->addEpsilonTransition(newAccept);
+        copy->accept->isAccepting = false;
+    } else {
+        // 可选部分：每一步都可以直接结束
+        for (int i = node->min; i < node->max; i++) {
+            auto copy = cloneFragment(pattern);
+            current->addEpsilonTransition(copy->start);
+            current->addEpsilonTransition(newAccept);
+            copy->accept->isAccepting = false;
+            current = copy->accept;
+        }
+    }
+    current->addEpsilonTransition(newAccept);
+
+    return make_shared<NFA>(start, newAccept);
+}
+
+shared_ptr<NFA> ThompsonConstruction::cloneFragment(shared_ptr<NFA> fragment) {
+    map<shared_ptr<NFAState>, shared_ptr<NFAState>> copies;
+    vector<shared_ptr<NFAState>> order;
+    copies[fragment->start] = make_shared<NFAState>(getNextStateId());
+    order.push_back(fragment->start);
+    for (size_t i = 0; i < order.size(); i++) {
+        auto original = order[i];
+        auto copy = copies[original];
+        for (auto &pair : original->transitions) {
+            for (auto target : pair.second) {
+                if (copies.find(target) == copies.end()) {
+                    copies[target] = make_shared<NFAState>(getNextStateId());
+                    order.push_back(target);
+                }
+                copy->transitions[pair.first].push_back(copies[target]);
+            }
+        }
+    }
+    return make_shared<NFA>(copies[fragment->start], copies[fragment->accept]);
+}
+
 // 任意字符的NFA：匹配除换行符外的所有字符
 shared_ptr<NFA> ThompsonConstruction::buildAny(shared_ptr<AnyNode> node) {
     auto start = make_shared<NFAState>(getNextStateId());
     auto accept = make_shared<NFAState>(getNextStateId());
 
-    // 为所有字符（0-255）添加转换，除了换行符 \n (10)
-    for (int i = 0; i < 256; i++) {
+    // 为所有字符（1-255）添加转换，除了换行符 \n (10)；'\0' 表示epsilon
+    for (int i = 1; i < 256; i++) {
         if (i != '\n') {
             start->addTransition(static_cast<char>(i), accept);
         }
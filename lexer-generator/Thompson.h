@@ -1,7 +1,11 @@
 #pragma once
+#include "DFA.h"
 #include "NFA.h"
 #include "RegexAST.h"
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 using namespace std;
 
@@ -18,6 +22,10 @@ class ThompsonConstruction {
     // 将AST转换为NFA
     shared_ptr<NFA> build(shared_ptr<ASTNode> ast);
 
+    // 全部由字面串组成的并（如关键字表）直接构造最小DFA，不经过NFA、子集
+    // 构造和最小化；ast 不是这种形式时返回 nullptr
+    static shared_ptr<DFA> buildLiteralDFA(shared_ptr<ASTNode> ast);
+
   private:
     // 为不同类型的节点构建NFA
     shared_ptr<NFA> buildChar(shared_ptr<CharNode> node);
@@ -26,6 +34,25 @@ class ThompsonConstruction {
     shared_ptr<NFA> buildUnion(shared_ptr<UnionNode> node);
     shared_ptr<NFA> buildStar(shared_ptr<StarNode> node);
     shared_ptr<NFA> buildPlus(shared_ptr<PlusNode> node);
+    shared_ptr<NFA> buildRepeat(shared_ptr<RepeatNode> node);
     shared_ptr<NFA> buildAny(shared_ptr<AnyNode> node);
     shared_ptr<NFA> buildEpsilon(shared_ptr<EpsilonNode> node);
+
+    // 全部由字面串组成的并直接构造为字典树
+    shared_ptr<NFA> buildLiteralTrie(const vector<string> &words);
+
+    // 字面串集合的字典树：结点 0 为根，子结点的编号总是大于父结点
+    static void buildTrie(vector<string> words,
+                          vector<vector<pair<char, int>>> &trie,
+                          vector<bool> &isEnd);
+
+    // 并的每个分支是否都是字面串，是则取出这些串
+    static bool literalUnion(shared_ptr<UnionNode> node,
+                             vector<string> &words);
+
+    // 节点是否为字面串（空串、单字符或单字符的连接），是则取出该串
+    static bool literalString(shared_ptr<ASTNode> node, string &word);
+
+    // 复制一个NFA片段（状态编号重新分配）
+    shared_ptr<NFA> cloneFragment(shared_ptr<NFA> fragment);
 };
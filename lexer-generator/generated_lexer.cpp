@@ -1,385 +1,2371 @@
-#include <string>
-#include <vector>
-#include <stdexcept>
+#include "generated_lexer.h"
+#include <cstdlib>
+#include <cstring>
 
 using namespace std;
 
-struct Token {
-    string type;
-    string value;
-    int line;
-    int column;
-    
-    Token(string t, string v, int l, int c) : type(t), value(v), line(l), column(c) {}
-    
-    string toString() const {
-        return "Token(" + type + ", " + value + ", " + to_string(line) + ", " + to_string(column) + ")";
+// 通用匹配引擎（稠密表）：transitions[state][char] = nextState（-1表示无转换）
+template <typename T>
+static int runDenseDFA(const T (*transitions)[256], const bool* accepting, int state,
+                       const string& text, size_t startPos) {
+    size_t currentPos = startPos;
+    size_t lastAcceptingPos = string::npos;
+    while (currentPos < text.length()) {
+        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
+        int nextState = transitions[state][ch];
+        if (nextState == -1) {
+            break;
+        }
+        state = nextState;
+        currentPos++;
+        if (accepting[state]) {
+            lastAcceptingPos = currentPos;
+        }
     }
-};
+    if (lastAcceptingPos != string::npos) {
+        return static_cast<int>(lastAcceptingPos - startPos);
+    }
+    return 0;
+}
 
-class Lexer {
-private:
-    string text;
-    size_t pos;
-    int line;
-    int column;
-    
-    int matchDFA0(size_t startPos);
-    int matchDFA1(size_t startPos);
-    int matchDFA2(size_t startPos);
-    int matchDFA3(size_t startPos);
-    int matchDFA4(size_t startPos);
-    int matchDFA5(size_t startPos);
-    int matchDFA6(size_t startPos);
-    int matchDFA7(size_t startPos);
-    int matchDFA8(size_t startPos);
-    int matchDFA9(size_t startPos);
-    int matchDFA10(size_t startPos);
-    int matchDFA11(size_t startPos);
-    int matchDFA12(size_t startPos);
-    int matchDFA13(size_t startPos);
-    int matchDFA14(size_t startPos);
-    int matchDFA15(size_t startPos);
-    int matchDFA16(size_t startPos);
-    int matchDFA17(size_t startPos);
-    int matchDFA18(size_t startPos);
-    int matchDFA19(size_t startPos);
-    int matchDFA20(size_t startPos);
-    int matchDFA21(size_t startPos);
-    int matchDFA22(size_t startPos);
-    int matchDFA23(size_t startPos);
-    int matchDFA24(size_t startPos);
-    int matchDFA25(size_t startPos);
-    int matchDFA26(size_t startPos);
-    int matchDFA27(size_t startPos);
-    int matchDFA28(size_t startPos);
-    int matchDFA29(size_t startPos);
-    int matchDFA30(size_t startPos);
-    int matchDFA31(size_t startPos);
-    int matchDFA32(size_t startPos);
-    int matchDFA33(size_t startPos);
-    int matchDFA34(size_t startPos);
-    int matchDFA35(size_t startPos);
-    int matchDFA36(size_t startPos);
-    int matchDFA37(size_t startPos);
-    int matchDFA38(size_t startPos);
-    
-public:
-    Lexer(const string& input) : text(input), pos(0), line(1), column(1) {}
-    
-    Token* nextToken();
-    vector<Token*> tokenize();
-};
+// 64 位整数中是否有为 0 的字节
+static inline bool hasZeroByte(unsigned long long v) {
+    return ((v - 0x0101010101010101ULL) & ~v & 0x8080808080808080ULL) != 0;
+}
 
-Token* Lexer::nextToken() {
-    // 跳过空白字符
-    while (pos < text.length() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r')) {
-        if (text[pos] == '\n') {
-            line++;
-            column = 1;
-        } else {
-            column++;
+// 字面量解码：在刚匹配过（仍在缓存中）的记号文本上转换，数字8位一组用SWAR处理
+static inline unsigned long long loadEightBytes(const char* p) {
+    unsigned long long v;
+    memcpy(&v, p, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+// 8个字节是否都是 '0'..'9'
+static inline bool isEightDigits(unsigned long long v) {
+    unsigned long long high = v & 0xF0F0F0F0F0F0F0F0ULL;
+    unsigned long long carry =
+        (v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL;
+    return (high | carry >> 4) == 0x3333333333333333ULL;
+}
+
+// 8位数字的值：相邻的1位、2位、4位数字两两合并，共3次乘法
+static inline unsigned long long parseEightDigits(unsigned long long v) {
+    v = ((v & 0x0F0F0F0F0F0F0F0FULL) * 2561) >> 8;
+    v = ((v & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+    return ((v & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+}
+
+// 读入一串十进制数字：跳过前导零，有效数字最多19位累加到 mantissa
+// （digits 为已累加的位数），其余计入 dropped；返回数字之后的位置
+static const char* readDigits(const char* p, const char* end,
+                              unsigned long long& mantissa, int& digits,
+                              int& dropped) {
+    if (digits == 0) {
+        while (p < end && *p == '0') {
+            p++;
+        }
+    }
+    while (end - p >= 8 && digits <= 11) {
+        unsigned long long v = loadEightBytes(p);
+        if (!isEightDigits(v)) {
+            break;
         }
-        pos++;
-    }
-    
-    if (pos >= text.length()) {
-        return nullptr;
-    }
-    
-    // 尝试匹配每个规则（按文件中的顺序）
-    int longestLength = 0;
-    string matchedType;
-    
-    // 规则: FLOAT_NUMBER
-    int match0 = matchDFA0(pos);
-    if (match0 > longestLength) {
-        longestLength = match0;
-        matchedType = "FLOAT_NUMBER";
-    }
-    
-    // 规则: NUMBER
-    int match1 = matchDFA1(pos);
-    if (match1 > longestLength) {
-        longestLength = match1;
-        matchedType = "NUMBER";
-    }
-    
-    // 规则: STRING_LITERAL
-    int match2 = matchDFA2(pos);
-    if (match2 > longestLength) {
-        longestLength = match2;
-        matchedType = "STRING_LITERAL";
-    }
-    
-    // 规则: IF
-    int match3 = matchDFA3(pos);
-    if (match3 > longestLength) {
-        longestLength = match3;
-        matchedType = "IF";
-    }
-    
-    // 规则: ELSE
-    int match4 = matchDFA4(pos);
-    if (match4 > longestLength) {
-        longestLength = match4;
-        matchedType = "ELSE";
-    }
-    
-    // 规则: FOR
-    int match5 = matchDFA5(pos);
-    if (match5 > longestLength) {
-        longestLength = match5;
-        matchedType = "FOR";
-    }
-    
-    // 规则: WHILE
-    int match6 = matchDFA6(pos);
-    if (match6 > longestLength) {
-        longestLength = match6;
-        matchedType = "WHILE";
-    }
-    
-    // 规则: DO
-    int match7 = matchDFA7(pos);
-    if (match7 > longestLength) {
-        longestLength = match7;
-        matchedType = "DO";
-    }
-    
-    // 规则: BREAK
-    int match8 = matchDFA8(pos);
-    if (match8 > longestLength) {
-        longestLength = match8;
-        matchedType = "BREAK";
-    }
-    
-    // 规则: CONTINUE
-    int match9 = matchDFA9(pos);
-    if (match9 > longestLength) {
-        longestLength = match9;
-        matchedType = "CONTINUE";
-    }
-    
-    // 规则: RETURN
-    int match10 = matchDFA10(pos);
-    if (match10 > longestLength) {
-        longestLength = match10;
-        matchedType = "RETURN";
-    }
-    
-    // 规则: VOID
-    int match11 = matchDFA11(pos);
-    if (match11 > longestLength) {
-        longestLength = match11;
-        matchedType = "VOID";
-    }
-    
-    // 规则: INT
-    int match12 = matchDFA12(pos);
-    if (match12 > longestLength) {
-        longestLength = match12;
-        matchedType = "INT";
-    }
-    
-    // 规则: FLOAT
-    int match13 = matchDFA13(pos);
-    if (match13 > longestLength) {
-        longestLength = match13;
-        matchedType = "FLOAT";
-    }
-    
-    // 规则: CHAR
-    int match14 = matchDFA14(pos);
-    if (match14 > longestLength) {
-        longestLength = match14;
-        matchedType = "CHAR";
-    }
-    
-    // 规则: STRING
-    int match15 = matchDFA15(pos);
-    if (match15 > longestLength) {
-        longestLength = match15;
-        matchedType = "STRING";
-    }
-    
-    // 规则: ID
-    int match16 = matchDFA16(pos);
-    if (match16 > longestLength) {
-        longestLength = match16;
-        matchedType = "ID";
-    }
-    
-    // 规则: NOT_EQUAL
-    int match17 = matchDFA17(pos);
-    if (match17 > longestLength) {
-        longestLength = match17;
-        matchedType = "NOT_EQUAL";
-    }
-    
-    // 规则: EQUAL_EQUAL
-    int match18 = matchDFA18(pos);
-    if (match18 > longestLength) {
-        longestLength = match18;
-        matchedType = "EQUAL_EQUAL";
-    }
-    
-    // 规则: GREATER_EQUAL
-    int match19 = matchDFA19(pos);
-    if (match19 > longestLength) {
-        longestLength = match19;
-        matchedType = "GREATER_EQUAL";
-    }
-    
-    // 规则: LESS_EQUAL
-    int match20 = matchDFA20(pos);
-    if (match20 > longestLength) {
-        longestLength = match20;
-        matchedType = "LESS_EQUAL";
-    }
-    
-    // 规则: EQUAL
-    int match21 = matchDFA21(pos);
-    if (match21 > longestLength) {
-        longestLength = match21;
-        matchedType = "EQUAL";
-    }
-    
-    // 规则: GREATER
-    int match22 = matchDFA22(pos);
-    if (match22 > longestLength) {
-        longestLength = match22;
-        matchedType = "GREATER";
-    }
-    
-    // 规则: LESS
-    int match23 = matchDFA23(pos);
-    if (match23 > longestLength) {
-        longestLength = match23;
-        matchedType = "LESS";
-    }
-    
-    // 规则: PLUS
-    int match24 = matchDFA24(pos);
-    if (match24 > longestLength) {
-        longestLength = match24;
-        matchedType = "PLUS";
-    }
-    
-    // 规则: MINUS
-    int match25 = matchDFA25(pos);
-    if (match25 > longestLength) {
-        longestLength = match25;
-        matchedType = "MINUS";
-    }
-    
-    // 规则: MULTIPLY
-    int match26 = matchDFA26(pos);
-    if (match26 > longestLength) {
-        longestLength = match26;
-        matchedType = "MULTIPLY";
-    }
-    
-    // 规则: DIVIDE
-    int match27 = matchDFA27(pos);
-    if (match27 > longestLength) {
-        longestLength = match27;
-        matchedType = "DIVIDE";
-    }
-    
-    // 规则: MOD
-    int match28 = matchDFA28(pos);
-    if (match28 > longestLength) {
-        longestLength = match28;
-        matchedType = "MOD";
-    }
-    
-    // 规则: COMMA
-    int match29 = matchDFA29(pos);
-    if (match29 > longestLength) {
-        longestLength = match29;
-        matchedType = "COMMA";
-    }
-    
-    // 规则: SEMICOLON
-    int match30 = matchDFA30(pos);
-    if (match30 > longestLength) {
-        longestLength = match30;
-        matchedType = "SEMICOLON";
-    }
-    
-    // 规则: COLON
-    int match31 = matchDFA31(pos);
-    if (match31 > longestLength) {
-        longestLength = match31;
-        matchedType = "COLON";
-    }
-    
-    // 规则: LPAREN
-    int match32 = matchDFA32(pos);
-    if (match32 > longestLength) {
-        longestLength = match32;
-        matchedType = "LPAREN";
-    }
-    
-    // 规则: RPAREN
-    int match33 = matchDFA33(pos);
-    if (match33 > longestLength) {
-        longestLength = match33;
-        matchedType = "RPAREN";
+        mantissa = mantissa * 100000000ULL + parseEightDigits(v);
+        digits += 8;
+        p += 8;
     }
-    
-    // 规则: LBRACE
-    int match34 = matchDFA34(pos);
-    if (match34 > longestLength) {
-        longestLength = match34;
-        matchedType = "LBRACE";
+    while (p < end && *p >= '0' && *p <= '9') {
+        if (digits < 19) {
+            mantissa = mantissa * 10 + (*p - '0');
+            digits++;
+        } else {
+            dropped++;
+        }
+        p++;
     }
-    
-    // 规则: RBRACE
-    int match35 = matchDFA35(pos);
-    if (match35 > longestLength) {
-        longestLength = match35;
-        matchedType = "RBRACE";
+    return p;
+}
+
+// INT64：可选的正负号后跟十进制数字，超出范围时取最大或最小值
+static long long decodeInt64(const char* p, size_t length) {
+    const char* end = p + length;
+    bool negative = p < end && *p == '-';
+    if (p < end && (*p == '-' || *p == '+')) {
+        p++;
+    }
+    unsigned long long mantissa = 0;
+    int digits = 0;
+    int dropped = 0;
+    readDigits(p, end, mantissa, digits, dropped);
+    unsigned long long limit = 9223372036854775807ULL + (negative ? 1 : 0);
+    if (dropped > 0 || mantissa > limit) {
+        mantissa = limit;
+    }
+    if (!negative || mantissa == 0) {
+        return static_cast<long long>(mantissa);
+    }
+    return -static_cast<long long>(mantissa - 1) - 1;
+}
+
+// DOUBLE：[+-]数字[.数字][(e|E)[+-]数字]
+static double decodeDouble(const char* p, size_t length) {
+    static const double powers[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                    1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                    1e18, 1e19, 1e20, 1e21, 1e22};
+    const char* begin = p;
+    const char* end = p + length;
+    bool negative = p < end && *p == '-';
+    if (p < end && (*p == '-' || *p == '+')) {
+        p++;
+    }
+    unsigned long long mantissa = 0;
+    int digits = 0;
+    int dropped = 0;
+    p = readDigits(p, end, mantissa, digits, dropped);
+    long exponent = dropped; // 整数部分舍去的数字
+    if (p < end && *p == '.') {
+        const char* fraction = ++p;
+        int droppedBefore = dropped;
+        p = readDigits(p, end, mantissa, digits, dropped);
+        exponent -= static_cast<long>(p - fraction) - (dropped - droppedBefore);
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        p++;
+        bool negativeExponent = p < end && *p == '-';
+        if (p < end && (*p == '-' || *p == '+')) {
+            p++;
+        }
+        long value = 0;
+        while (p < end && *p >= '0' && *p <= '9') {
+            if (value < 100000) {
+                value = value * 10 + (*p - '0');
+            }
+            p++;
+        }
+        exponent += negativeExponent ? -value : value;
+    }
+    // 快速路径：尾数不超过 2^53、10的幂次不超过22时两者都能精确表示，
+    // 一次乘除即为正确舍入的结果；其余情况回退到 strtod
+    if (dropped == 0 && mantissa <= (1ULL << 53) && exponent >= -22 &&
+        exponent <= 22) {
+        double value = static_cast<double>(mantissa);
+        value = exponent < 0 ? value / powers[-exponent]
+                             : value * powers[exponent];
+        return negative ? -value : value;
+    }
+    return strtod(string(begin, end).c_str(), nullptr);
+}
+
+// UNESCAPE：去掉首尾成对的引号，处理 \n \t \r \0，其他 \x 取 x 本身
+static string decodeUnescape(const char* p, size_t length) {
+    if (length >= 2 && (p[0] == '"' || p[0] == '\'') &&
+        p[length - 1] == p[0]) {
+        p++;
+        length -= 2;
+    }
+    const char* end = p + length;
+    string result;
+    result.reserve(length);
+    while (p < end) {
+        const char* slash =
+            static_cast<const char*>(memchr(p, '\\', end - p));
+        if (!slash || slash + 1 == end) {
+            result.append(p, end);
+            break;
+        }
+        result.append(p, slash);
+        char ch = slash[1];
+        result += ch == 'n'   ? '\n'
+                  : ch == 't' ? '\t'
+                  : ch == 'r' ? '\r'
+                  : ch == '0' ? '\0'
+                              : ch;
+        p = slash + 2;
     }
-    
-    // 规则: LBRACKET
-    int match36 = matchDFA36(pos);
-    if (match36 > longestLength) {
-        longestLength = match36;
-        matchedType = "LBRACKET";
+    return result;
+}
+
+// 符号的哈希值：每次取8个字节与状态异或后乘以奇数常量
+static inline unsigned hashSymbol(const char* p, size_t length) {
+    unsigned long long h = 0x9E3779B97F4A7C15ULL ^ length;
+    for (; length >= 8; p += 8, length -= 8) {
+        unsigned long long w;
+        memcpy(&w, p, 8);
+        h = (h ^ w) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 29;
+    }
+    if (length > 0) {
+        unsigned long long w = 0;
+        memcpy(&w, p, length);
+        h = (h ^ w) * 0xFF51AFD7ED558CCDULL;
+    }
+    h ^= h >> 32;
+    return static_cast<unsigned>(h);
+}
+
+unsigned Lexer::intern(const char* p, size_t length) {
+    unsigned hash = hashSymbol(p, length);
+    // 装载因子不超过 1/2，超过时容量加倍并按保存的哈希值重新放置
+    if (symbols.size() * 2 >= symbolSlots.size()) {
+        size_t capacity = symbolSlots.empty() ? 256 : symbolSlots.size() * 2;
+        symbolSlots.assign(capacity, 0);
+        for (size_t id = 0; id < symbols.size(); id++) {
+            size_t i = symbolHashes[id] & (capacity - 1);
+            while (symbolSlots[i] != 0) {
+                i = (i + 1) & (capacity - 1);
+            }
+            symbolSlots[i] = static_cast<unsigned>(id + 1);
+        }
+    }
+    size_t mask = symbolSlots.size() - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        unsigned slot = symbolSlots[i];
+        if (slot == 0) {
+            symbols.push_back(string(p, length));
+            symbolHashes.push_back(hash);
+            symbolSlots[i] = static_cast<unsigned>(symbols.size());
+            return static_cast<unsigned>(symbols.size() - 1);
+        }
+        const string& name = symbols[slot - 1];
+        if (symbolHashes[slot - 1] == hash && name.size() == length &&
+            memcmp(name.data(), p, length) == 0) {
+            return slot - 1;
+        }
     }
-    
-    // 规则: RBRACKET
-    int match37 = matchDFA37(pos);
-    if (match37 > longestLength) {
-        longestLength = match37;
-        matchedType = "RBRACKET";
+}
+
+// 规则: FLOAT_NUMBER
+static const bool dfa0Accepting[4] = {false, false, false, true};
+static const signed char dfa0Transitions[4][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 3
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: STRING_LITERAL
+static const bool dfa2Accepting[3] = {false, false, true};
+static const signed char dfa2Transitions[3][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: IF
+static const bool dfa3Accepting[3] = {false, false, true};
+static const signed char dfa3Transitions[3][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: ELSE
+static const bool dfa4Accepting[5] = {false, false, false, false, true};
+static const signed char dfa4Transitions[5][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 3
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 4
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: FOR
+static const bool dfa5Accepting[4] = {false, false, false, true};
+static const signed char dfa5Transitions[4][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 3
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: WHILE
+static const bool dfa6Accepting[6] = {false, false, false, false, false, true};
+static const signed char dfa6Transitions[6][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 3
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 4
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 5
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: DO
+static const bool dfa7Accepting[3] = {false, false, true};
+static const signed char dfa7Transitions[3][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: BREAK
+static const bool dfa8Accepting[6] = {false, false, false, false, false, true};
+static const signed char dfa8Transitions[6][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 3
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 4
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 5
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: CONTINUE
+static const bool dfa9Accepting[9] = {false, false, false, false, false, false, false, false, true};
+static const signed char dfa9Transitions[9][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 3
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 4
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 5
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 6
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 7
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, 8, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 8
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: RETURN
+static const bool dfa10Accepting[7] = {false, false, false, false, false, false, true};
+static const signed char dfa10Transitions[7][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 3
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 4
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 5
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 6
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: VOID
+static const bool dfa11Accepting[5] = {false, false, false, false, true};
+static const signed char dfa11Transitions[5][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 3
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 4
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: INT
+static const bool dfa12Accepting[4] = {false, false, false, true};
+static const signed char dfa12Transitions[4][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 3
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: FLOAT
+static const bool dfa13Accepting[6] = {false, false, false, false, false, true};
+static const signed char dfa13Transitions[6][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 3
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 4
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 5
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: CHAR
+static const bool dfa14Accepting[5] = {false, false, false, false, true};
+static const signed char dfa14Transitions[5][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 3
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 4
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: STRING
+static const bool dfa15Accepting[7] = {false, false, false, false, false, false, true};
+static const signed char dfa15Transitions[7][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 3
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, 4, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 4
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 5
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 6
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: ID
+static const bool dfa16Accepting[2] = {false, true};
+static const signed char dfa16Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, 1,
+     -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1,
+     -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, 1,
+     -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: NOT_EQUAL
+static const bool dfa17Accepting[3] = {false, false, true};
+static const signed char dfa17Transitions[3][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: EQUAL_EQUAL
+static const bool dfa18Accepting[3] = {false, false, true};
+static const signed char dfa18Transitions[3][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: GREATER_EQUAL
+static const bool dfa19Accepting[3] = {false, false, true};
+static const signed char dfa19Transitions[3][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: LESS_EQUAL
+static const bool dfa20Accepting[3] = {false, false, true};
+static const signed char dfa20Transitions[3][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: EQUAL
+static const bool dfa21Accepting[2] = {false, true};
+static const signed char dfa21Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: GREATER
+static const bool dfa22Accepting[2] = {false, true};
+static const signed char dfa22Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: LESS
+static const bool dfa23Accepting[2] = {false, true};
+static const signed char dfa23Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: PLUS
+static const bool dfa24Accepting[2] = {false, true};
+static const signed char dfa24Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: MINUS
+static const bool dfa25Accepting[2] = {false, true};
+static const signed char dfa25Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: MULTIPLY
+static const bool dfa26Accepting[2] = {false, true};
+static const signed char dfa26Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: DIVIDE
+static const bool dfa27Accepting[2] = {false, true};
+static const signed char dfa27Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: MOD
+static const bool dfa28Accepting[2] = {false, true};
+static const signed char dfa28Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: COMMA
+static const bool dfa29Accepting[2] = {false, true};
+static const signed char dfa29Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: SEMICOLON
+static const bool dfa30Accepting[2] = {false, true};
+static const signed char dfa30Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: COLON
+static const bool dfa31Accepting[2] = {false, true};
+static const signed char dfa31Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: LPAREN
+static const bool dfa32Accepting[2] = {false, true};
+static const signed char dfa32Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: RPAREN
+static const bool dfa33Accepting[2] = {false, true};
+static const signed char dfa33Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: LBRACE
+static const bool dfa34Accepting[2] = {false, true};
+static const signed char dfa34Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: RBRACE
+static const bool dfa35Accepting[2] = {false, true};
+static const signed char dfa35Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: LBRACKET
+static const bool dfa36Accepting[2] = {false, true};
+static const signed char dfa36Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: RBRACKET
+static const bool dfa37Accepting[2] = {false, true};
+static const signed char dfa37Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: LINE_COMMENT
+static const bool dfa38Accepting[3] = {false, false, true};
+static const signed char dfa38Transitions[3][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, 2, 2, 2, 2, 2, 2, 2, 2, 2, -1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+     2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+     2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+     2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+     2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+     2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+     2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+     2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2},
+};
+
+// 规则: BLOCK_COMMENT
+static const bool dfa39Accepting[3] = {false, false, true};
+static const signed char dfa39Transitions[3][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: COMMENT_END
+static const bool dfa40Accepting[3] = {false, false, true};
+static const signed char dfa40Transitions[3][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 2
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 规则: COMMENT_STAR
+static const bool dfa42Accepting[2] = {false, true};
+static const signed char dfa42Transitions[2][256] = {
+    // 状态 0
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    // 状态 1
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+     -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// 首字节候选规则：candidates[mode][ch][i / 64] 的第 i % 64 位表示规则 i 可能以字节 ch 开头
+static const unsigned long long candidates[2][256][1] = {
+    // 模式 INITIAL
+    {
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x20000ULL}, {0x4ULL}, {0x0ULL},
+        {0x0ULL}, {0x10000000ULL}, {0x0ULL}, {0x0ULL},
+        {0x100000000ULL}, {0x200000000ULL}, {0x4000000ULL}, {0x1000000ULL},
+        {0x20000000ULL}, {0x2000000ULL}, {0x0ULL}, {0xc008000000ULL},
+        {0x3ULL}, {0x3ULL}, {0x3ULL}, {0x3ULL},
+        {0x3ULL}, {0x3ULL}, {0x3ULL}, {0x3ULL},
+        {0x3ULL}, {0x3ULL}, {0x80000000ULL}, {0x40000000ULL},
+        {0x900000ULL}, {0x240000ULL}, {0x480000ULL}, {0x0ULL},
+        {0x0ULL}, {0x10000ULL}, {0x10000ULL}, {0x10000ULL},
+        {0x10000ULL}, {0x10000ULL}, {0x10000ULL}, {0x10000ULL},
+        {0x10000ULL}, {0x10000ULL}, {0x10000ULL}, {0x10000ULL},
+        {0x10000ULL}, {0x10000ULL}, {0x10000ULL}, {0x10000ULL},
+        {0x10000ULL}, {0x10000ULL}, {0x10000ULL}, {0x10000ULL},
+        {0x10000ULL}, {0x10000ULL}, {0x10000ULL}, {0x10000ULL},
+        {0x10000ULL}, {0x10000ULL}, {0x10000ULL}, {0x1000000000ULL},
+        {0x0ULL}, {0x2000000000ULL}, {0x0ULL}, {0x10000ULL},
+        {0x0ULL}, {0x10000ULL}, {0x10100ULL}, {0x14200ULL},
+        {0x10080ULL}, {0x10010ULL}, {0x12020ULL}, {0x10000ULL},
+        {0x10000ULL}, {0x11008ULL}, {0x10000ULL}, {0x10000ULL},
+        {0x10000ULL}, {0x10000ULL}, {0x10000ULL}, {0x10000ULL},
+        {0x10000ULL}, {0x10000ULL}, {0x10400ULL}, {0x18000ULL},
+        {0x10000ULL}, {0x10000ULL}, {0x10800ULL}, {0x10040ULL},
+        {0x10000ULL}, {0x10000ULL}, {0x10000ULL}, {0x400000000ULL},
+        {0x0ULL}, {0x800000000ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+        {0x0ULL}, {0x0ULL}, {0x0ULL}, {0x0ULL},
+    },
+    // 模式 COMMENT
+    {
+        {0x0ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x50000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+        {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL}, {0x20000000000ULL},
+    },
+};
+
+// 模式名，用于错误信息
+static const char* const modeNames[2] = {"INITIAL", "COMMENT"};
+
+// 可能跨行的记号：按其中的换行符更新行号和列号
+void Lexer::advance(size_t length) {
+    const char* p = text.data() + pos;
+    const char* end = p + length;
+    const char* newline;
+    while ((newline = static_cast<const char*>(
+                memchr(p, '\n', end - p))) != nullptr) {
+        line++;
+        column = 1;
+        p = newline + 1;
+    }
+    column += static_cast<int>(end - p);
+    pos += length;
+}
+
+bool Lexer::scanToken(Token& token) {
+    while (true) {
+        // 跳过空白字符（只在 INITIAL 模式中）
+        if (mode == MODE_INITIAL) {
+            while (pos < text.length() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r')) {
+                if (text[pos] == '\n') {
+                    line++;
+                    column = 1;
+                } else {
+                    column++;
+                }
+                pos++;
+            }
+        }
+        
+        if (pos >= text.length()) {
+            if (mode != MODE_INITIAL) {
+                // 错误：输入在非 INITIAL 模式中结束
+                throw runtime_error("Unexpected end of input in mode " + string(modeNames[mode]) + " at line " + to_string(line) + ", column " + to_string(column));
+            }
+            return false;
+        }
+        
+        unsigned char first = static_cast<unsigned char>(text[pos]);
+        const unsigned long long* cand = candidates[mode][first];
+        
+        // 尝试匹配每个候选规则（按文件中的顺序）
+        int longestLength = 0;
+        const char* matchedType = nullptr;
+        int matchedRule = -1;
+        
+        // 规则: FLOAT_NUMBER
+        if (cand[0] & (1ULL << 0)) {
+            int match0 = matchDFA0(pos);
+            if (match0 > longestLength) {
+                longestLength = match0;
+                matchedType = "FLOAT_NUMBER";
+                matchedRule = 0;
+            }
+        }
+        
+        // 规则: NUMBER
+        if (cand[0] & (1ULL << 1)) {
+            int match1 = matchDFA1(pos);
+            if (match1 > longestLength) {
+                longestLength = match1;
+                matchedType = "NUMBER";
+                matchedRule = 1;
+            }
+        }
+        
+        // 规则: STRING_LITERAL
+        if (cand[0] & (1ULL << 2)) {
+            int match2 = matchDFA2(pos);
+            if (match2 > longestLength) {
+                longestLength = match2;
+                matchedType = "STRING_LITERAL";
+                matchedRule = 2;
+            }
+        }
+        
+        // 规则: IF
+        if (cand[0] & (1ULL << 3)) {
+            int match3 = matchDFA3(pos);
+            if (match3 > longestLength) {
+                longestLength = match3;
+                matchedType = "IF";
+                matchedRule = 3;
+            }
+        }
+        
+        // 规则: ELSE
+        if (cand[0] & (1ULL << 4)) {
+            int match4 = matchDFA4(pos);
+            if (match4 > longestLength) {
+                longestLength = match4;
+                matchedType = "ELSE";
+                matchedRule = 4;
+            }
+        }
+        
+        // 规则: FOR
+        if (cand[0] & (1ULL << 5)) {
+            int match5 = matchDFA5(pos);
+            if (match5 > longestLength) {
+                longestLength = match5;
+                matchedType = "FOR";
+                matchedRule = 5;
+            }
+        }
+        
+        // 规则: WHILE
+        if (cand[0] & (1ULL << 6)) {
+            int match6 = matchDFA6(pos);
+            if (match6 > longestLength) {
+                longestLength = match6;
+                matchedType = "WHILE";
+                matchedRule = 6;
+            }
+        }
+        
+        // 规则: DO
+        if (cand[0] & (1ULL << 7)) {
+            int match7 = matchDFA7(pos);
+            if (match7 > longestLength) {
+                longestLength = match7;
+                matchedType = "DO";
+                matchedRule = 7;
+            }
+        }
+        
+        // 规则: BREAK
+        if (cand[0] & (1ULL << 8)) {
+            int match8 = matchDFA8(pos);
+            if (match8 > longestLength) {
+                longestLength = match8;
+                matchedType = "BREAK";
+                matchedRule = 8;
+            }
+        }
+        
+        // 规则: CONTINUE
+        if (cand[0] & (1ULL << 9)) {
+            int match9 = matchDFA9(pos);
+            if (match9 > longestLength) {
+                longestLength = match9;
+                matchedType = "CONTINUE";
+                matchedRule = 9;
+            }
+        }
+        
+        // 规则: RETURN
+        if (cand[0] & (1ULL << 10)) {
+            int match10 = matchDFA10(pos);
+            if (match10 > longestLength) {
+                longestLength = match10;
+                matchedType = "RETURN";
+                matchedRule = 10;
+            }
+        }
+        
+        // 规则: VOID
+        if (cand[0] & (1ULL << 11)) {
+            int match11 = matchDFA11(pos);
+            if (match11 > longestLength) {
+                longestLength = match11;
+                matchedType = "VOID";
+                matchedRule = 11;
+            }
+        }
+        
+        // 规则: INT
+        if (cand[0] & (1ULL << 12)) {
+            int match12 = matchDFA12(pos);
+            if (match12 > longestLength) {
+                longestLength = match12;
+                matchedType = "INT";
+                matchedRule = 12;
+            }
+        }
+        
+        // 规则: FLOAT
+        if (cand[0] & (1ULL << 13)) {
+            int match13 = matchDFA13(pos);
+            if (match13 > longestLength) {
+                longestLength = match13;
+                matchedType = "FLOAT";
+                matchedRule = 13;
+            }
+        }
+        
+        // 规则: CHAR
+        if (cand[0] & (1ULL << 14)) {
+            int match14 = matchDFA14(pos);
+            if (match14 > longestLength) {
+                longestLength = match14;
+                matchedType = "CHAR";
+                matchedRule = 14;
+            }
+        }
+        
+        // 规则: STRING
+        if (cand[0] & (1ULL << 15)) {
+            int match15 = matchDFA15(pos);
+            if (match15 > longestLength) {
+                longestLength = match15;
+                matchedType = "STRING";
+                matchedRule = 15;
+            }
+        }
+        
+        // 规则: ID
+        if (cand[0] & (1ULL << 16)) {
+            int match16 = matchDFA16(pos);
+            if (match16 > longestLength) {
+                longestLength = match16;
+                matchedType = "ID";
+                matchedRule = 16;
+            }
+        }
+        
+        // 规则: NOT_EQUAL
+        if (cand[0] & (1ULL << 17)) {
+            int match17 = matchDFA17(pos);
+            if (match17 > longestLength) {
+                longestLength = match17;
+                matchedType = "NOT_EQUAL";
+                matchedRule = 17;
+            }
+        }
+        
+        // 规则: EQUAL_EQUAL
+        if (cand[0] & (1ULL << 18)) {
+            int match18 = matchDFA18(pos);
+            if (match18 > longestLength) {
+                longestLength = match18;
+                matchedType = "EQUAL_EQUAL";
+                matchedRule = 18;
+            }
+        }
+        
+        // 规则: GREATER_EQUAL
+        if (cand[0] & (1ULL << 19)) {
+            int match19 = matchDFA19(pos);
+            if (match19 > longestLength) {
+                longestLength = match19;
+                matchedType = "GREATER_EQUAL";
+                matchedRule = 19;
+            }
+        }
+        
+        // 规则: LESS_EQUAL
+        if (cand[0] & (1ULL << 20)) {
+            int match20 = matchDFA20(pos);
+            if (match20 > longestLength) {
+                longestLength = match20;
+                matchedType = "LESS_EQUAL";
+                matchedRule = 20;
+            }
+        }
+        
+        // 规则: EQUAL
+        if (cand[0] & (1ULL << 21)) {
+            int match21 = matchDFA21(pos);
+            if (match21 > longestLength) {
+                longestLength = match21;
+                matchedType = "EQUAL";
+                matchedRule = 21;
+            }
+        }
+        
+        // 规则: GREATER
+        if (cand[0] & (1ULL << 22)) {
+            int match22 = matchDFA22(pos);
+            if (match22 > longestLength) {
+                longestLength = match22;
+                matchedType = "GREATER";
+                matchedRule = 22;
+            }
+        }
+        
+        // 规则: LESS
+        if (cand[0] & (1ULL << 23)) {
+            int match23 = matchDFA23(pos);
+            if (match23 > longestLength) {
+                longestLength = match23;
+                matchedType = "LESS";
+                matchedRule = 23;
+            }
+        }
+        
+        // 规则: PLUS
+        if (cand[0] & (1ULL << 24)) {
+            int match24 = matchDFA24(pos);
+            if (match24 > longestLength) {
+                longestLength = match24;
+                matchedType = "PLUS";
+                matchedRule = 24;
+            }
+        }
+        
+        // 规则: MINUS
+        if (cand[0] & (1ULL << 25)) {
+            int match25 = matchDFA25(pos);
+            if (match25 > longestLength) {
+                longestLength = match25;
+                matchedType = "MINUS";
+                matchedRule = 25;
+            }
+        }
+        
+        // 规则: MULTIPLY
+        if (cand[0] & (1ULL << 26)) {
+            int match26 = matchDFA26(pos);
+            if (match26 > longestLength) {
+                longestLength = match26;
+                matchedType = "MULTIPLY";
+                matchedRule = 26;
+            }
+        }
+        
+        // 规则: DIVIDE
+        if (cand[0] & (1ULL << 27)) {
+            int match27 = matchDFA27(pos);
+            if (match27 > longestLength) {
+                longestLength = match27;
+                matchedType = "DIVIDE";
+                matchedRule = 27;
+            }
+        }
+        
+        // 规则: MOD
+        if (cand[0] & (1ULL << 28)) {
+            int match28 = matchDFA28(pos);
+            if (match28 > longestLength) {
+                longestLength = match28;
+                matchedType = "MOD";
+                matchedRule = 28;
+            }
+        }
+        
+        // 规则: COMMA
+        if (cand[0] & (1ULL << 29)) {
+            int match29 = matchDFA29(pos);
+            if (match29 > longestLength) {
+                longestLength = match29;
+                matchedType = "COMMA";
+                matchedRule = 29;
+            }
+        }
+        
+        // 规则: SEMICOLON
+        if (cand[0] & (1ULL << 30)) {
+            int match30 = matchDFA30(pos);
+            if (match30 > longestLength) {
+                longestLength = match30;
+                matchedType = "SEMICOLON";
+                matchedRule = 30;
+            }
+        }
+        
+        // 规则: COLON
+        if (cand[0] & (1ULL << 31)) {
+            int match31 = matchDFA31(pos);
+            if (match31 > longestLength) {
+                longestLength = match31;
+                matchedType = "COLON";
+                matchedRule = 31;
+            }
+        }
+        
+        // 规则: LPAREN
+        if (cand[0] & (1ULL << 32)) {
+            int match32 = matchDFA32(pos);
+            if (match32 > longestLength) {
+                longestLength = match32;
+                matchedType = "LPAREN";
+                matchedRule = 32;
+            }
+        }
+        
+        // 规则: RPAREN
+        if (cand[0] & (1ULL << 33)) {
+            int match33 = matchDFA33(pos);
+            if (match33 > longestLength) {
+                longestLength = match33;
+                matchedType = "RPAREN";
+                matchedRule = 33;
+            }
+        }
+        
+        // 规则: LBRACE
+        if (cand[0] & (1ULL << 34)) {
+            int match34 = matchDFA34(pos);
+            if (match34 > longestLength) {
+                longestLength = match34;
+                matchedType = "LBRACE";
+                matchedRule = 34;
+            }
+        }
+        
+        // 规则: RBRACE
+        if (cand[0] & (1ULL << 35)) {
+            int match35 = matchDFA35(pos);
+            if (match35 > longestLength) {
+                longestLength = match35;
+                matchedType = "RBRACE";
+                matchedRule = 35;
+            }
+        }
+        
+        // 规则: LBRACKET
+        if (cand[0] & (1ULL << 36)) {
+            int match36 = matchDFA36(pos);
+            if (match36 > longestLength) {
+                longestLength = match36;
+                matchedType = "LBRACKET";
+                matchedRule = 36;
+            }
+        }
+        
+        // 规则: RBRACKET
+        if (cand[0] & (1ULL << 37)) {
+            int match37 = matchDFA37(pos);
+            if (match37 > longestLength) {
+                longestLength = match37;
+                matchedType = "RBRACKET";
+                matchedRule = 37;
+            }
+        }
+        
+        // 规则: LINE_COMMENT (IGNORE)
+        if (cand[0] & (1ULL << 38)) {
+            int match38 = matchDFA38(pos);
+            if (match38 > 0) {
+                pos += match38;
+                column += match38;
+                continue; // 继续匹配下一个token
+            }
+        }
+        
+        // 规则: BLOCK_COMMENT (IGNORE)
+        if (cand[0] & (1ULL << 39)) {
+            int match39 = matchDFA39(pos);
+            if (match39 > 0) {
+                pos += match39;
+                column += match39;
+                pushMode(MODE_COMMENT);
+                continue; // 继续匹配下一个token
+            }
+        }
+        
+        // 规则: COMMENT_END (IGNORE)
+        if (cand[0] & (1ULL << 40)) {
+            int match40 = matchDFA40(pos);
+            if (match40 > 0) {
+                pos += match40;
+                column += match40;
+                popMode();
+                continue; // 继续匹配下一个token
+            }
+        }
+        
+        // 规则: COMMENT_TEXT (IGNORE)
+        if (cand[0] & (1ULL << 41)) {
+            int match41 = matchDFA41(pos);
+            if (match41 > 0) {
+                advance(match41);
+                continue; // 继续匹配下一个token
+            }
+        }
+        
+        // 规则: COMMENT_STAR (IGNORE)
+        if (cand[0] & (1ULL << 42)) {
+            int match42 = matchDFA42(pos);
+            if (match42 > 0) {
+                pos += match42;
+                column += match42;
+                continue; // 继续匹配下一个token
+            }
+        }
+        
+        if (longestLength > 0) {
+            fillToken(token, matchedType, longestLength);
+            const char* literal = text.data() + pos;
+            switch (matchedRule) {
+            case 0: // FLOAT_NUMBER
+                token.floatValue = decodeDouble(literal, longestLength);
+                break;
+            case 1: // NUMBER
+                token.intValue = decodeInt64(literal, longestLength);
+                break;
+            case 2: // STRING_LITERAL
+                token.stringValue = decodeUnescape(literal, longestLength);
+                break;
+            case 16: // ID
+                token.symbol = intern(literal, longestLength);
+                break;
+            default:
+                break;
+            }
+            pos += longestLength;
+            column += longestLength;
+            switch (matchedRule) {
+            default:
+                break;
+            }
+            return true;
+        }
+        
+        // 错误：无法识别的字符
+        throw runtime_error("Unexpected character '" + string(1, text[pos]) + "' at line " + to_string(line) + ", column " + to_string(column));
     }
-    
-    // 规则: LINE_COMMENT (IGNORE)
-    int match38 = matchDFA38(pos);
-    if (match38 > 0) {
-        pos += match38;
-        column += match38;
-        return nextToken();  // 继续匹配下一个token
+}
+
+void Lexer::fillToken(Token& token, const char* type, size_t length) {
+    token.type.assign(type);
+    token.value.assign(text, pos, length);
+    token.line = line;
+    token.column = column;
+    token.intValue = 0;
+    token.floatValue = 0;
+    token.stringValue.clear();
+    token.symbol = 0;
+}
+
+Token* Lexer::nextToken() {
+    Token token("", "", 0, 0);
+    if (!scanToken(token)) {
+        return nullptr;
     }
-    
-    if (longestLength > 0) {
-        string value = text.substr(pos, longestLength);
-        Token* token = new Token(matchedType, value, line, column);
-        pos += longestLength;
-        column += longestLength;
-        return token;
+    return new Token(std::move(token));
+}
+
+void Lexer::reset(const char* data, size_t length) {
+    text.assign(data, length);
+    pos = 0;
+    line = 1;
+    column = 1;
+    mode = 0;
+    modeStack.clear();
+    failed0.clear();
+    failed2.clear();
+}
+
+size_t Lexer::tokenizeInto(vector<Token>& tokens) {
+    size_t count = 0;
+    while (true) {
+        if (count == tokens.size()) {
+            tokens.push_back(Token("", "", 0, 0));
+        }
+        if (!scanToken(tokens[count])) {
+            break;
+        }
+        count++;
     }
-    
-    // 错误：无法识别的字符
-    throw runtime_error("Unexpected character '" + string(1, text[pos]) + "' at line " + to_string(line) + ", column " + to_string(column));
+    tokens.erase(tokens.begin() + count, tokens.end());
+    return count;
 }
 
 vector<Token*> Lexer::tokenize() {
     vector<Token*> tokens;
-    while (pos < text.length()) {
+    while (true) {
         Token* token = nextToken();
         if (token) {
             tokens.push_back(token);
@@ -391,68 +2377,25 @@ vector<Token*> Lexer::tokenize() {
 }
 
 int Lexer::matchDFA0(size_t startPos) {
-    int state = 3;
+    const auto& accepting = dfa0Accepting;
+    const auto& transitions = dfa0Transitions;
+    
+    int state = 0;
     size_t currentPos = startPos;
     size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[4] = {false, false, true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[4][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 4; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][48] = 2;
-    transitions[0][49] = 2;
-    transitions[0][50] = 2;
-    transitions[0][51] = 2;
-    transitions[0][52] = 2;
-    transitions[0][53] = 2;
-    transitions[0][54] = 2;
-    transitions[0][55] = 2;
-    transitions[0][56] = 2;
-    transitions[0][57] = 2;
-    transitions[1][46] = 0;
-    transitions[1][48] = 1;
-    transitions[1][49] = 1;
-    transitions[1][50] = 1;
-    transitions[1][51] = 1;
-    transitions[1][52] = 1;
-    transitions[1][53] = 1;
-    transitions[1][54] = 1;
-    transitions[1][55] = 1;
-    transitions[1][56] = 1;
-    transitions[1][57] = 1;
-    transitions[2][48] = 2;
-    transitions[2][49] = 2;
-    transitions[2][50] = 2;
-    transitions[2][51] = 2;
-    transitions[2][52] = 2;
-    transitions[2][53] = 2;
-    transitions[2][54] = 2;
-    transitions[2][55] = 2;
-    transitions[2][56] = 2;
-    transitions[2][57] = 2;
-    transitions[3][48] = 1;
-    transitions[3][49] = 1;
-    transitions[3][50] = 1;
-    transitions[3][51] = 1;
-    transitions[3][52] = 1;
-    transitions[3][53] = 1;
-    transitions[3][54] = 1;
-    transitions[3][55] = 1;
-    transitions[3][56] = 1;
-    transitions[3][57] = 1;
+    failed0.start(startPos);
+    munchTrail.clear();
+    size_t trailStart = startPos;
+    munchTrail.push_back(state);
     
     // 执行DFA匹配
     while (currentPos < text.length()) {
+        if (failed0.failed(currentPos, state)) {
+            break; // 之前已证明从这里出发不会再接受
+        }
         unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
+        int nextState;
+        nextState = transitions[state][ch];
         if (nextState == -1) {
             break;
         }
@@ -460,9 +2403,16 @@ int Lexer::matchDFA0(size_t startPos) {
         currentPos++;
         if (accepting[state]) {
             lastAcceptingPos = currentPos;
+            munchTrail.clear();
+            trailStart = currentPos + 1;
+        } else {
+            munchTrail.push_back(state);
         }
     }
     
+    // 最后一次接受之后经过的 (状态, 位置) 都不可能再到达接受状态
+    failed0.mark(trailStart, munchTrail);
+    
     if (lastAcceptingPos != string::npos) {
         return static_cast<int>(lastAcceptingPos - startPos);
     }
@@ -470,340 +2420,45 @@ int Lexer::matchDFA0(size_t startPos) {
 }
 
 int Lexer::matchDFA1(size_t startPos) {
-    int state = 1;
+    const char* begin = text.data() + startPos;
+    const char* end = text.data() + text.length();
+    static const bool inSet[256] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+    };
+    const char* p = begin;
+    while (p < end && inSet[static_cast<unsigned char>(*p)]) {
+        p++;
+    }
+    return static_cast<int>(p - begin);
+}
+
+int Lexer::matchDFA2(size_t startPos) {
+    const auto& accepting = dfa2Accepting;
+    const auto& transitions = dfa2Transitions;
+    
+    int state = 0;
     size_t currentPos = startPos;
     size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][48] = 0;
-    transitions[0][49] = 0;
-    transitions[0][50] = 0;
-    transitions[0][51] = 0;
-    transitions[0][52] = 0;
-    transitions[0][53] = 0;
-    transitions[0][54] = 0;
-    transitions[0][55] = 0;
-    transitions[0][56] = 0;
-    transitions[0][57] = 0;
-    transitions[1][48] = 0;
-    transitions[1][49] = 0;
-    transitions[1][50] = 0;
-    transitions[1][51] = 0;
-    transitions[1][52] = 0;
-    transitions[1][53] = 0;
-    transitions[1][54] = 0;
-    transitions[1][55] = 0;
-    transitions[1][56] = 0;
-    transitions[1][57] = 0;
+    failed2.start(startPos);
+    munchTrail.clear();
+    size_t trailStart = startPos;
+    munchTrail.push_back(state);
     
     // 执行DFA匹配
     while (currentPos < text.length()) {
+        if (failed2.failed(currentPos, state)) {
+            break; // 之前已证明从这里出发不会再接受
+        }
         unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
-}
-
-int Lexer::matchDFA2(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[3] = {false, false, true};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[3][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][34] = 1;
-    transitions[1][128] = 1;
-    transitions[1][129] = 1;
-    transitions[1][130] = 1;
-    transitions[1][131] = 1;
-    transitions[1][132] = 1;
-    transitions[1][133] = 1;
-    transitions[1][134] = 1;
-    transitions[1][135] = 1;
-    transitions[1][136] = 1;
-    transitions[1][137] = 1;
-    transitions[1][138] = 1;
-    transitions[1][139] = 1;
-    transitions[1][140] = 1;
-    transitions[1][141] = 1;
-    transitions[1][142] = 1;
-    transitions[1][143] = 1;
-    transitions[1][144] = 1;
-    transitions[1][145] = 1;
-    transitions[1][146] = 1;
-    transitions[1][147] = 1;
-    transitions[1][148] = 1;
-    transitions[1][149] = 1;
-    transitions[1][150] = 1;
-    transitions[1][151] = 1;
-    transitions[1][152] = 1;
-    transitions[1][153] = 1;
-    transitions[1][154] = 1;
-    transitions[1][155] = 1;
-    transitions[1][156] = 1;
-    transitions[1][157] = 1;
-    transitions[1][158] = 1;
-    transitions[1][159] = 1;
-    transitions[1][160] = 1;
-    transitions[1][161] = 1;
-    transitions[1][162] = 1;
-    transitions[1][163] = 1;
-    transitions[1][164] = 1;
-    transitions[1][165] = 1;
-    transitions[1][166] = 1;
-    transitions[1][167] = 1;
-    transitions[1][168] = 1;
-    transitions[1][169] = 1;
-    transitions[1][170] = 1;
-    transitions[1][171] = 1;
-    transitions[1][172] = 1;
-    transitions[1][173] = 1;
-    transitions[1][174] = 1;
-    transitions[1][175] = 1;
-    transitions[1][176] = 1;
-    transitions[1][177] = 1;
-    transitions[1][178] = 1;
-    transitions[1][179] = 1;
-    transitions[1][180] = 1;
-    transitions[1][181] = 1;
-    transitions[1][182] = 1;
-    transitions[1][183] = 1;
-    transitions[1][184] = 1;
-    transitions[1][185] = 1;
-    transitions[1][186] = 1;
-    transitions[1][187] = 1;
-    transitions[1][188] = 1;
-    transitions[1][189] = 1;
-    transitions[1][190] = 1;
-    transitions[1][191] = 1;
-    transitions[1][192] = 1;
-    transitions[1][193] = 1;
-    transitions[1][194] = 1;
-    transitions[1][195] = 1;
-    transitions[1][196] = 1;
-    transitions[1][197] = 1;
-    transitions[1][198] = 1;
-    transitions[1][199] = 1;
-    transitions[1][200] = 1;
-    transitions[1][201] = 1;
-    transitions[1][202] = 1;
-    transitions[1][203] = 1;
-    transitions[1][204] = 1;
-    transitions[1][205] = 1;
-    transitions[1][206] = 1;
-    transitions[1][207] = 1;
-    transitions[1][208] = 1;
-    transitions[1][209] = 1;
-    transitions[1][210] = 1;
-    transitions[1][211] = 1;
-    transitions[1][212] = 1;
-    transitions[1][213] = 1;
-    transitions[1][214] = 1;
-    transitions[1][215] = 1;
-    transitions[1][216] = 1;
-    transitions[1][217] = 1;
-    transitions[1][218] = 1;
-    transitions[1][219] = 1;
-    transitions[1][220] = 1;
-    transitions[1][221] = 1;
-    transitions[1][222] = 1;
-    transitions[1][223] = 1;
-    transitions[1][224] = 1;
-    transitions[1][225] = 1;
-    transitions[1][226] = 1;
-    transitions[1][227] = 1;
-    transitions[1][228] = 1;
-    transitions[1][229] = 1;
-    transitions[1][230] = 1;
-    transitions[1][231] = 1;
-    transitions[1][232] = 1;
-    transitions[1][233] = 1;
-    transitions[1][234] = 1;
-    transitions[1][235] = 1;
-    transitions[1][236] = 1;
-    transitions[1][237] = 1;
-    transitions[1][238] = 1;
-    transitions[1][239] = 1;
-    transitions[1][240] = 1;
-    transitions[1][241] = 1;
-    transitions[1][242] = 1;
-    transitions[1][243] = 1;
-    transitions[1][244] = 1;
-    transitions[1][245] = 1;
-    transitions[1][246] = 1;
-    transitions[1][247] = 1;
-    transitions[1][248] = 1;
-    transitions[1][249] = 1;
-    transitions[1][250] = 1;
-    transitions[1][251] = 1;
-    transitions[1][252] = 1;
-    transitions[1][253] = 1;
-    transitions[1][254] = 1;
-    transitions[1][255] = 1;
-    transitions[1][1] = 1;
-    transitions[1][2] = 1;
-    transitions[1][3] = 1;
-    transitions[1][4] = 1;
-    transitions[1][5] = 1;
-    transitions[1][6] = 1;
-    transitions[1][7] = 1;
-    transitions[1][8] = 1;
-    transitions[1][9] = 1;
-    transitions[1][11] = 1;
-    transitions[1][12] = 1;
-    transitions[1][13] = 1;
-    transitions[1][14] = 1;
-    transitions[1][15] = 1;
-    transitions[1][16] = 1;
-    transitions[1][17] = 1;
-    transitions[1][18] = 1;
-    transitions[1][19] = 1;
-    transitions[1][20] = 1;
-    transitions[1][21] = 1;
-    transitions[1][22] = 1;
-    transitions[1][23] = 1;
-    transitions[1][24] = 1;
-    transitions[1][25] = 1;
-    transitions[1][26] = 1;
-    transitions[1][27] = 1;
-    transitions[1][28] = 1;
-    transitions[1][29] = 1;
-    transitions[1][30] = 1;
-    transitions[1][31] = 1;
-    transitions[1][32] = 1;
-    transitions[1][33] = 1;
-    transitions[1][34] = 2;
-    transitions[1][35] = 1;
-    transitions[1][36] = 1;
-    transitions[1][37] = 1;
-    transitions[1][38] = 1;
-    transitions[1][39] = 1;
-    transitions[1][40] = 1;
-    transitions[1][41] = 1;
-    transitions[1][42] = 1;
-    transitions[1][43] = 1;
-    transitions[1][44] = 1;
-    transitions[1][45] = 1;
-    transitions[1][46] = 1;
-    transitions[1][47] = 1;
-    transitions[1][48] = 1;
-    transitions[1][49] = 1;
-    transitions[1][50] = 1;
-    transitions[1][51] = 1;
-    transitions[1][52] = 1;
-    transitions[1][53] = 1;
-    transitions[1][54] = 1;
-    transitions[1][55] = 1;
-    transitions[1][56] = 1;
-    transitions[1][57] = 1;
-    transitions[1][58] = 1;
-    transitions[1][59] = 1;
-    transitions[1][60] = 1;
-    transitions[1][61] = 1;
-    transitions[1][62] = 1;
-    transitions[1][63] = 1;
-    transitions[1][64] = 1;
-    transitions[1][65] = 1;
-    transitions[1][66] = 1;
-    transitions[1][67] = 1;
-    transitions[1][68] = 1;
-    transitions[1][69] = 1;
-    transitions[1][70] = 1;
-    transitions[1][71] = 1;
-    transitions[1][72] = 1;
-    transitions[1][73] = 1;
-    transitions[1][74] = 1;
-    transitions[1][75] = 1;
-    transitions[1][76] = 1;
-    transitions[1][77] = 1;
-    transitions[1][78] = 1;
-    transitions[1][79] = 1;
-    transitions[1][80] = 1;
-    transitions[1][81] = 1;
-    transitions[1][82] = 1;
-    transitions[1][83] = 1;
-    transitions[1][84] = 1;
-    transitions[1][85] = 1;
-    transitions[1][86] = 1;
-    transitions[1][87] = 1;
-    transitions[1][88] = 1;
-    transitions[1][89] = 1;
-    transitions[1][90] = 1;
-    transitions[1][91] = 1;
-    transitions[1][92] = 1;
-    transitions[1][93] = 1;
-    transitions[1][94] = 1;
-    transitions[1][95] = 1;
-    transitions[1][96] = 1;
-    transitions[1][97] = 1;
-    transitions[1][98] = 1;
-    transitions[1][99] = 1;
-    transitions[1][100] = 1;
-    transitions[1][101] = 1;
-    transitions[1][102] = 1;
-    transitions[1][103] = 1;
-    transitions[1][104] = 1;
-    transitions[1][105] = 1;
-    transitions[1][106] = 1;
-    transitions[1][107] = 1;
-    transitions[1][108] = 1;
-    transitions[1][109] = 1;
-    transitions[1][110] = 1;
-    transitions[1][111] = 1;
-    transitions[1][112] = 1;
-    transitions[1][113] = 1;
-    transitions[1][114] = 1;
-    transitions[1][115] = 1;
-    transitions[1][116] = 1;
-    transitions[1][117] = 1;
-    transitions[1][118] = 1;
-    transitions[1][119] = 1;
-    transitions[1][120] = 1;
-    transitions[1][121] = 1;
-    transitions[1][122] = 1;
-    transitions[1][123] = 1;
-    transitions[1][124] = 1;
-    transitions[1][125] = 1;
-    transitions[1][126] = 1;
-    transitions[1][127] = 1;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
+        int nextState;
+        nextState = transitions[state][ch];
         if (nextState == -1) {
             break;
         }
@@ -811,9 +2466,16 @@ int Lexer::matchDFA2(size_t startPos) {
         currentPos++;
         if (accepting[state]) {
             lastAcceptingPos = currentPos;
+            munchTrail.clear();
+            trailStart = currentPos + 1;
+        } else {
+            munchTrail.push_back(state);
         }
     }
     
+    // 最后一次接受之后经过的 (状态, 位置) 都不可能再到达接受状态
+    failed2.mark(trailStart, munchTrail);
+    
     if (lastAcceptingPos != string::npos) {
         return static_cast<int>(lastAcceptingPos - startPos);
     }
@@ -821,1824 +2483,186 @@ int Lexer::matchDFA2(size_t startPos) {
 }
 
 int Lexer::matchDFA3(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[3] = {true, false, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[3][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][105] = 2;
-    transitions[2][102] = 0;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa3Transitions, dfa3Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA4(size_t startPos) {
-    int state = 2;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[5] = {true, false, false, false, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[5][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 5; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][108] = 3;
-    transitions[2][101] = 1;
-    transitions[3][115] = 4;
-    transitions[4][101] = 0;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa4Transitions, dfa4Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA5(size_t startPos) {
-    int state = 3;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[4] = {true, false, false, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[4][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 4; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][114] = 0;
-    transitions[2][111] = 1;
-    transitions[3][102] = 2;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa5Transitions, dfa5Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA6(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[6] = {false, false, false, true, false, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[6][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 6; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][119] = 2;
-    transitions[1][101] = 3;
-    transitions[2][104] = 5;
-    transitions[4][108] = 1;
-    transitions[5][105] = 4;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa6Transitions, dfa6Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA7(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[3] = {false, true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[3][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][100] = 2;
-    transitions[2][111] = 1;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa7Transitions, dfa7Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA8(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[6] = {false, false, false, true, false, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[6][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 6; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][98] = 4;
-    transitions[1][97] = 5;
-    transitions[2][101] = 1;
-    transitions[4][114] = 2;
-    transitions[5][107] = 3;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa8Transitions, dfa8Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA9(size_t startPos) {
-    int state = 5;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[9] = {true, false, false, false, false, false, false, false, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[9][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 9; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][116] = 8;
-    transitions[2][110] = 1;
-    transitions[3][111] = 2;
-    transitions[4][101] = 0;
-    transitions[5][99] = 3;
-    transitions[6][110] = 7;
-    transitions[7][117] = 4;
-    transitions[8][105] = 6;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa9Transitions, dfa9Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA10(size_t startPos) {
-    int state = 6;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[7] = {true, false, false, false, false, false, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[7][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 7; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][116] = 4;
-    transitions[2][110] = 0;
-    transitions[3][101] = 1;
-    transitions[4][117] = 5;
-    transitions[5][114] = 2;
-    transitions[6][114] = 3;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa10Transitions, dfa10Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA11(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[5] = {false, false, false, false, true};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[5][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 5; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][118] = 3;
-    transitions[1][105] = 2;
-    transitions[2][100] = 4;
-    transitions[3][111] = 1;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa11Transitions, dfa11Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA12(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[4] = {false, false, true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[4][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 4; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][105] = 1;
-    transitions[1][110] = 3;
-    transitions[3][116] = 2;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa12Transitions, dfa12Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA13(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[6] = {false, false, false, false, false, true};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[6][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 6; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][108] = 4;
-    transitions[1][102] = 0;
-    transitions[2][97] = 3;
-    transitions[3][116] = 5;
-    transitions[4][111] = 2;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa13Transitions, dfa13Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA14(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[5] = {true, false, false, false, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[5][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 5; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][99] = 4;
-    transitions[2][97] = 3;
-    transitions[3][114] = 0;
-    transitions[4][104] = 2;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa14Transitions, dfa14Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA15(size_t startPos) {
-    int state = 2;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[7] = {false, false, false, false, false, true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[7][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 7; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][116] = 1;
-    transitions[1][114] = 3;
-    transitions[2][115] = 0;
-    transitions[3][105] = 6;
-    transitions[4][103] = 5;
-    transitions[6][110] = 4;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa15Transitions, dfa15Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA16(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][48] = 0;
-    transitions[0][49] = 0;
-    transitions[0][50] = 0;
-    transitions[0][51] = 0;
-    transitions[0][52] = 0;
-    transitions[0][53] = 0;
-    transitions[0][54] = 0;
-    transitions[0][55] = 0;
-    transitions[0][56] = 0;
-    transitions[0][57] = 0;
-    transitions[0][65] = 0;
-    transitions[0][66] = 0;
-    transitions[0][67] = 0;
-    transitions[0][68] = 0;
-    transitions[0][69] = 0;
-    transitions[0][70] = 0;
-    transitions[0][71] = 0;
-    transitions[0][72] = 0;
-    transitions[0][73] = 0;
-    transitions[0][74] = 0;
-    transitions[0][75] = 0;
-    transitions[0][76] = 0;
-    transitions[0][77] = 0;
-    transitions[0][78] = 0;
-    transitions[0][79] = 0;
-    transitions[0][80] = 0;
-    transitions[0][81] = 0;
-    transitions[0][82] = 0;
-    transitions[0][83] = 0;
-    transitions[0][84] = 0;
-    transitions[0][85] = 0;
-    transitions[0][86] = 0;
-    transitions[0][87] = 0;
-    transitions[0][88] = 0;
-    transitions[0][89] = 0;
-    transitions[0][90] = 0;
-    transitions[0][95] = 0;
-    transitions[0][97] = 0;
-    transitions[0][98] = 0;
-    transitions[0][99] = 0;
-    transitions[0][100] = 0;
-    transitions[0][101] = 0;
-    transitions[0][102] = 0;
-    transitions[0][103] = 0;
-    transitions[0][104] = 0;
-    transitions[0][105] = 0;
-    transitions[0][106] = 0;
-    transitions[0][107] = 0;
-    transitions[0][108] = 0;
-    transitions[0][109] = 0;
-    transitions[0][110] = 0;
-    transitions[0][111] = 0;
-    transitions[0][112] = 0;
-    transitions[0][113] = 0;
-    transitions[0][114] = 0;
-    transitions[0][115] = 0;
-    transitions[0][116] = 0;
-    transitions[0][117] = 0;
-    transitions[0][118] = 0;
-    transitions[0][119] = 0;
-    transitions[0][120] = 0;
-    transitions[0][121] = 0;
-    transitions[0][122] = 0;
-    transitions[1][65] = 0;
-    transitions[1][66] = 0;
-    transitions[1][67] = 0;
-    transitions[1][68] = 0;
-    transitions[1][69] = 0;
-    transitions[1][70] = 0;
-    transitions[1][71] = 0;
-    transitions[1][72] = 0;
-    transitions[1][73] = 0;
-    transitions[1][74] = 0;
-    transitions[1][75] = 0;
-    transitions[1][76] = 0;
-    transitions[1][77] = 0;
-    transitions[1][78] = 0;
-    transitions[1][79] = 0;
-    transitions[1][80] = 0;
-    transitions[1][81] = 0;
-    transitions[1][82] = 0;
-    transitions[1][83] = 0;
-    transitions[1][84] = 0;
-    transitions[1][85] = 0;
-    transitions[1][86] = 0;
-    transitions[1][87] = 0;
-    transitions[1][88] = 0;
-    transitions[1][89] = 0;
-    transitions[1][90] = 0;
-    transitions[1][95] = 0;
-    transitions[1][97] = 0;
-    transitions[1][98] = 0;
-    transitions[1][99] = 0;
-    transitions[1][100] = 0;
-    transitions[1][101] = 0;
-    transitions[1][102] = 0;
-    transitions[1][103] = 0;
-    transitions[1][104] = 0;
-    transitions[1][105] = 0;
-    transitions[1][106] = 0;
-    transitions[1][107] = 0;
-    transitions[1][108] = 0;
-    transitions[1][109] = 0;
-    transitions[1][110] = 0;
-    transitions[1][111] = 0;
-    transitions[1][112] = 0;
-    transitions[1][113] = 0;
-    transitions[1][114] = 0;
-    transitions[1][115] = 0;
-    transitions[1][116] = 0;
-    transitions[1][117] = 0;
-    transitions[1][118] = 0;
-    transitions[1][119] = 0;
-    transitions[1][120] = 0;
-    transitions[1][121] = 0;
-    transitions[1][122] = 0;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa16Transitions, dfa16Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA17(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[3] = {false, false, true};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[3][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][61] = 2;
-    transitions[1][33] = 0;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa17Transitions, dfa17Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA18(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[3] = {false, true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[3][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][61] = 2;
-    transitions[2][61] = 1;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa18Transitions, dfa18Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA19(size_t startPos) {
-    int state = 2;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[3] = {false, true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[3][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][61] = 1;
-    transitions[2][62] = 0;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa19Transitions, dfa19Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA20(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[3] = {true, false, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[3][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][60] = 2;
-    transitions[2][61] = 0;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa20Transitions, dfa20Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA21(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][61] = 0;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa21Transitions, dfa21Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA22(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][62] = 0;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa22Transitions, dfa22Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA23(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][60] = 0;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa23Transitions, dfa23Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA24(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {false, true};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][43] = 1;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa24Transitions, dfa24Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA25(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][45] = 0;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
-}
-
-int Lexer::matchDFA26(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][42] = 0;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
-}
-
-int Lexer::matchDFA27(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][47] = 0;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
-}
-
-int Lexer::matchDFA28(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {false, true};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][37] = 1;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
-}
-
-int Lexer::matchDFA29(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {false, true};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][44] = 1;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa25Transitions, dfa25Accepting, 0, text, startPos);
+}
+
+int Lexer::matchDFA26(size_t startPos) {
+    return runDenseDFA(dfa26Transitions, dfa26Accepting, 0, text, startPos);
+}
+
+int Lexer::matchDFA27(size_t startPos) {
+    return runDenseDFA(dfa27Transitions, dfa27Accepting, 0, text, startPos);
+}
+
+int Lexer::matchDFA28(size_t startPos) {
+    return runDenseDFA(dfa28Transitions, dfa28Accepting, 0, text, startPos);
+}
+
+int Lexer::matchDFA29(size_t startPos) {
+    return runDenseDFA(dfa29Transitions, dfa29Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA30(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {false, true};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][59] = 1;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa30Transitions, dfa30Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA31(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {false, true};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][58] = 1;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa31Transitions, dfa31Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA32(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][40] = 0;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa32Transitions, dfa32Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA33(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {false, true};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][41] = 1;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa33Transitions, dfa33Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA34(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {false, true};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][123] = 1;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa34Transitions, dfa34Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA35(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {true, false};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[1][125] = 0;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa35Transitions, dfa35Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA36(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {false, true};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][91] = 1;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa36Transitions, dfa36Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA37(size_t startPos) {
-    int state = 0;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[2] = {false, true};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[2][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 2; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][93] = 1;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
-            break;
-        }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
-    }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
-    }
-    return 0;
+    return runDenseDFA(dfa37Transitions, dfa37Accepting, 0, text, startPos);
 }
 
 int Lexer::matchDFA38(size_t startPos) {
-    int state = 1;
-    size_t currentPos = startPos;
-    size_t lastAcceptingPos = string::npos;
-    
-    // 接受状态集合
-    bool accepting[3] = {false, false, true};
-    
-    // 状态转换表: transitions[state][char] = nextState
-    int transitions[3][256];
-    // 初始化为-1（无转换）
-    for (int i = 0; i < 3; i++) {
-        for (int j = 0; j < 256; j++) {
-            transitions[i][j] = -1;
-        }
-    }
-    
-    transitions[0][47] = 2;
-    transitions[1][47] = 0;
-    transitions[2][128] = 2;
-    transitions[2][129] = 2;
-    transitions[2][130] = 2;
-    transitions[2][131] = 2;
-    transitions[2][132] = 2;
-    transitions[2][133] = 2;
-    transitions[2][134] = 2;
-    transitions[2][135] = 2;
-    transitions[2][136] = 2;
-    transitions[2][137] = 2;
-    transitions[2][138] = 2;
-    transitions[2][139] = 2;
-    transitions[2][140] = 2;
-    transitions[2][141] = 2;
-    transitions[2][142] = 2;
-    transitions[2][143] = 2;
-    transitions[2][144] = 2;
-    transitions[2][145] = 2;
-    transitions[2][146] = 2;
-    transitions[2][147] = 2;
-    transitions[2][148] = 2;
-    transitions[2][149] = 2;
-    transitions[2][150] = 2;
-    transitions[2][151] = 2;
-    transitions[2][152] = 2;
-    transitions[2][153] = 2;
-    transitions[2][154] = 2;
-    transitions[2][155] = 2;
-    transitions[2][156] = 2;
-    transitions[2][157] = 2;
-    transitions[2][158] = 2;
-    transitions[2][159] = 2;
-    transitions[2][160] = 2;
-    transitions[2][161] = 2;
-    transitions[2][162] = 2;
-    transitions[2][163] = 2;
-    transitions[2][164] = 2;
-    transitions[2][165] = 2;
-    transitions[2][166] = 2;
-    transitions[2][167] = 2;
-    transitions[2][168] = 2;
-    transitions[2][169] = 2;
-    transitions[2][170] = 2;
-    transitions[2][171] = 2;
-    transitions[2][172] = 2;
-    transitions[2][173] = 2;
-    transitions[2][174] = 2;
-    transitions[2][175] = 2;
-    transitions[2][176] = 2;
-    transitions[2][177] = 2;
-    transitions[2][178] = 2;
-    transitions[2][179] = 2;
-    transitions[2][180] = 2;
-    transitions[2][181] = 2;
-    transitions[2][182] = 2;
-    transitions[2][183] = 2;
-    transitions[2][184] = 2;
-    transitions[2][185] = 2;
-    transitions[2][186] = 2;
-    transitions[2][187] = 2;
-    transitions[2][188] = 2;
-    transitions[2][189] = 2;
-    transitions[2][190] = 2;
-    transitions[2][191] = 2;
-    transitions[2][192] = 2;
-    transitions[2][193] = 2;
-    transitions[2][194] = 2;
-    transitions[2][195] = 2;
-    transitions[2][196] = 2;
-    transitions[2][197] = 2;
-    transitions[2][198] = 2;
-    transitions[2][199] = 2;
-    transitions[2][200] = 2;
-    transitions[2][201] = 2;
-    transitions[2][202] = 2;
-    transitions[2][203] = 2;
-    transitions[2][204] = 2;
-    transitions[2][205] = 2;
-    transitions[2][206] = 2;
-    transitions[2][207] = 2;
-    transitions[2][208] = 2;
-    transitions[2][209] = 2;
-    transitions[2][210] = 2;
-    transitions[2][211] = 2;
-    transitions[2][212] = 2;
-    transitions[2][213] = 2;
-    transitions[2][214] = 2;
-    transitions[2][215] = 2;
-    transitions[2][216] = 2;
-    transitions[2][217] = 2;
-    transitions[2][218] = 2;
-    transitions[2][219] = 2;
-    transitions[2][220] = 2;
-    transitions[2][221] = 2;
-    transitions[2][222] = 2;
-    transitions[2][223] = 2;
-    transitions[2][224] = 2;
-    transitions[2][225] = 2;
-    transitions[2][226] = 2;
-    transitions[2][227] = 2;
-    transitions[2][228] = 2;
-    transitions[2][229] = 2;
-    transitions[2][230] = 2;
-    transitions[2][231] = 2;
-    transitions[2][232] = 2;
-    transitions[2][233] = 2;
-    transitions[2][234] = 2;
-    transitions[2][235] = 2;
-    transitions[2][236] = 2;
-    transitions[2][237] = 2;
-    transitions[2][238] = 2;
-    transitions[2][239] = 2;
-    transitions[2][240] = 2;
-    transitions[2][241] = 2;
-    transitions[2][242] = 2;
-    transitions[2][243] = 2;
-    transitions[2][244] = 2;
-    transitions[2][245] = 2;
-    transitions[2][246] = 2;
-    transitions[2][247] = 2;
-    transitions[2][248] = 2;
-    transitions[2][249] = 2;
-    transitions[2][250] = 2;
-    transitions[2][251] = 2;
-    transitions[2][252] = 2;
-    transitions[2][253] = 2;
-    transitions[2][254] = 2;
-    transitions[2][255] = 2;
-    transitions[2][1] = 2;
-    transitions[2][2] = 2;
-    transitions[2][3] = 2;
-    transitions[2][4] = 2;
-    transitions[2][5] = 2;
-    transitions[2][6] = 2;
-    transitions[2][7] = 2;
-    transitions[2][8] = 2;
-    transitions[2][9] = 2;
-    transitions[2][11] = 2;
-    transitions[2][12] = 2;
-    transitions[2][13] = 2;
-    transitions[2][14] = 2;
-    transitions[2][15] = 2;
-    transitions[2][16] = 2;
-    transitions[2][17] = 2;
-    transitions[2][18] = 2;
-    transitions[2][19] = 2;
-    transitions[2][20] = 2;
-    transitions[2][21] = 2;
-    transitions[2][22] = 2;
-    transitions[2][23] = 2;
-    transitions[2][24] = 2;
-    transitions[2][25] = 2;
-    transitions[2][26] = 2;
-    transitions[2][27] = 2;
-    transitions[2][28] = 2;
-    transitions[2][29] = 2;
-    transitions[2][30] = 2;
-    transitions[2][31] = 2;
-    transitions[2][32] = 2;
-    transitions[2][33] = 2;
-    transitions[2][34] = 2;
-    transitions[2][35] = 2;
-    transitions[2][36] = 2;
-    transitions[2][37] = 2;
-    transitions[2][38] = 2;
-    transitions[2][39] = 2;
-    transitions[2][40] = 2;
-    transitions[2][41] = 2;
-    transitions[2][42] = 2;
-    transitions[2][43] = 2;
-    transitions[2][44] = 2;
-    transitions[2][45] = 2;
-    transitions[2][46] = 2;
-    transitions[2][47] = 2;
-    transitions[2][48] = 2;
-    transitions[2][49] = 2;
-    transitions[2][50] = 2;
-    transitions[2][51] = 2;
-    transitions[2][52] = 2;
-    transitions[2][53] = 2;
-    transitions[2][54] = 2;
-    transitions[2][55] = 2;
-    transitions[2][56] = 2;
-    transitions[2][57] = 2;
-    transitions[2][58] = 2;
-    transitions[2][59] = 2;
-    transitions[2][60] = 2;
-    transitions[2][61] = 2;
-    transitions[2][62] = 2;
-    transitions[2][63] = 2;
-    transitions[2][64] = 2;
-    transitions[2][65] = 2;
-    transitions[2][66] = 2;
-    transitions[2][67] = 2;
-    transitions[2][68] = 2;
-    transitions[2][69] = 2;
-    transitions[2][70] = 2;
-    transitions[2][71] = 2;
-    transitions[2][72] = 2;
-    transitions[2][73] = 2;
-    transitions[2][74] = 2;
-    transitions[2][75] = 2;
-    transitions[2][76] = 2;
-    transitions[2][77] = 2;
-    transitions[2][78] = 2;
-    transitions[2][79] = 2;
-    transitions[2][80] = 2;
-    transitions[2][81] = 2;
-    transitions[2][82] = 2;
-    transitions[2][83] = 2;
-    transitions[2][84] = 2;
-    transitions[2][85] = 2;
-    transitions[2][86] = 2;
-    transitions[2][87] = 2;
-    transitions[2][88] = 2;
-    transitions[2][89] = 2;
-    transitions[2][90] = 2;
-    transitions[2][91] = 2;
-    transitions[2][92] = 2;
-    transitions[2][93] = 2;
-    transitions[2][94] = 2;
-    transitions[2][95] = 2;
-    transitions[2][96] = 2;
-    transitions[2][97] = 2;
-    transitions[2][98] = 2;
-    transitions[2][99] = 2;
-    transitions[2][100] = 2;
-    transitions[2][101] = 2;
-    transitions[2][102] = 2;
-    transitions[2][103] = 2;
-    transitions[2][104] = 2;
-    transitions[2][105] = 2;
-    transitions[2][106] = 2;
-    transitions[2][107] = 2;
-    transitions[2][108] = 2;
-    transitions[2][109] = 2;
-    transitions[2][110] = 2;
-    transitions[2][111] = 2;
-    transitions[2][112] = 2;
-    transitions[2][113] = 2;
-    transitions[2][114] = 2;
-    transitions[2][115] = 2;
-    transitions[2][116] = 2;
-    transitions[2][117] = 2;
-    transitions[2][118] = 2;
-    transitions[2][119] = 2;
-    transitions[2][120] = 2;
-    transitions[2][121] = 2;
-    transitions[2][122] = 2;
-    transitions[2][123] = 2;
-    transitions[2][124] = 2;
-    transitions[2][125] = 2;
-    transitions[2][126] = 2;
-    transitions[2][127] = 2;
-    
-    // 执行DFA匹配
-    while (currentPos < text.length()) {
-        unsigned char ch = static_cast<unsigned char>(text[currentPos]);
-        int nextState = transitions[state][ch];
-        if (nextState == -1) {
+    return runDenseDFA(dfa38Transitions, dfa38Accepting, 0, text, startPos);
+}
+
+int Lexer::matchDFA39(size_t startPos) {
+    return runDenseDFA(dfa39Transitions, dfa39Accepting, 0, text, startPos);
+}
+
+int Lexer::matchDFA40(size_t startPos) {
+    return runDenseDFA(dfa40Transitions, dfa40Accepting, 0, text, startPos);
+}
+
+int Lexer::matchDFA41(size_t startPos) {
+    const char* begin = text.data() + startPos;
+    const char* end = text.data() + text.length();
+    static const bool inSet[256] = {
+        0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+        1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+    };
+    const char* p = begin;
+    for (; end - p >= 8; p += 8) {
+        unsigned long long w;
+        memcpy(&w, p, 8);
+        if (hasZeroByte(w) |
+            hasZeroByte(w ^ 0x2a2a2a2a2a2a2a2aULL)) {
             break;
         }
-        state = nextState;
-        currentPos++;
-        if (accepting[state]) {
-            lastAcceptingPos = currentPos;
-        }
     }
-    
-    if (lastAcceptingPos != string::npos) {
-        return static_cast<int>(lastAcceptingPos - startPos);
+    while (p < end && inSet[static_cast<unsigned char>(*p)]) {
+        p++;
     }
-    return 0;
+    return static_cast<int>(p - begin);
+}
+
+int Lexer::matchDFA42(size_t startPos) {
+    return runDenseDFA(dfa42Transitions, dfa42Accepting, 0, text, startPos);
 }
 
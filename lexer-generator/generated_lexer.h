@@ -0,0 +1,212 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <cstring>
+
+using namespace std;
+
+struct Token {
+    string type;
+    string value;
+    int line;
+    int column;
+    long long intValue = 0; // INT64 规则的值
+    double floatValue = 0; // DOUBLE 规则的值
+    string stringValue; // UNESCAPE 规则处理转义后的内容
+    unsigned symbol = 0; // INTERN 规则的符号编号，见 Lexer::symbolName
+    
+    Token(string t, string v, int l, int c) : type(t), value(v), line(l), column(c) {}
+    
+    string toString() const {
+        return "Token(" + type + ", " + value + ", " + to_string(line) + ", " + to_string(column) + ")";
+    }
+};
+
+#ifndef TOKEN_SOURCE_DEFINED
+#define TOKEN_SOURCE_DEFINED
+// 按需产生记号的来源：语法分析器每次拉取一个记号，不必先得到整个记号序列
+class TokenSource {
+public:
+    virtual ~TokenSource() {}
+    // 把下一个记号写入 token（原有内容被覆盖），没有记号时返回 false
+    virtual bool next(Token& token) = 0;
+};
+#endif
+
+// 线性时间最长匹配的失败记忆：第 (位置 - base) * states + state 位表示
+// 从 (state, 位置) 出发不可能再到达接受状态。记号只向后推进，起点之前
+// 的行不会再被查询：起点越过所有用过的行时清零这些行，越过一半时把其余
+// 的行移到开头。内存与当前记号起点之后扫描过的范围成正比，不按输入长度
+// 分配，并在记号之间重用
+struct FailureMemo {
+    vector<unsigned long long> bits;
+    size_t base;   // 第 0 行对应的输入位置
+    size_t rows;   // 用过的行数，之后的位全为 0
+    size_t states; // 每行的位数
+    size_t align;  // 行数是它的倍数时行边界落在字边界上
+    
+    explicit FailureMemo(size_t stateCount)
+        : base(0), rows(0), states(stateCount), align(64) {
+        while (align % 2 == 0 && align / 2 * states % 64 == 0) {
+            align /= 2;
+        }
+    }
+    
+    // 开始从 startPos 出发的一次匹配，丢弃 startPos 之前的行
+    void start(size_t startPos) {
+        if (startPos >= base + rows) {
+            clear();
+            base = startPos;
+        } else if ((startPos - base) * 2 > rows) {
+            // 按整字移动，base 停在 startPos 之前最近的对齐行
+            size_t drop = (startPos - base) / align * align;
+            size_t dead = drop * states / 64;
+            size_t used = words(rows);
+            memmove(bits.data(), bits.data() + dead,
+                    (used - dead) * sizeof(bits[0]));
+            memset(bits.data() + used - dead, 0, dead * sizeof(bits[0]));
+            base += drop;
+            rows -= drop;
+        }
+    }
+    
+    bool failed(size_t position, int state) const {
+        size_t row = position - base;
+        size_t key = row * states + state;
+        return row < rows && ((bits[key >> 6] >> (key & 63)) & 1);
+    }
+    
+    // trail[j] 是位置 from + j 上的状态
+    void mark(size_t from, const vector<int>& trail) {
+        size_t end = from + trail.size() - base;
+        if (end > rows) {
+            if (bits.size() < words(end)) {
+                bits.resize(words(end), 0);
+            }
+            rows = end;
+        }
+        for (size_t j = 0; j < trail.size(); j++) {
+            size_t key = (from + j - base) * states + trail[j];
+            bits[key >> 6] |= 1ULL << (key & 63);
+        }
+    }
+    
+    // 清零用过的行，容量保留
+    void clear() {
+        if (rows > 0) {
+            memset(bits.data(), 0, words(rows) * sizeof(bits[0]));
+        }
+        base = 0;
+        rows = 0;
+    }
+    
+    size_t words(size_t rowCount) const {
+        return (rowCount * states + 63) / 64;
+    }
+};
+
+class Lexer : public TokenSource {
+private:
+    string text;
+    size_t pos;
+    int line;
+    int column;
+    int mode;               // 当前模式（起始条件）
+    vector<int> modeStack;  // PUSH 时保存的模式
+    
+    // 线性时间最长匹配：规则 N 已知失败的 (状态, 位置)
+    FailureMemo failed0{4};
+    FailureMemo failed2{3};
+    vector<int> munchTrail; // 最后一次接受之后经过的状态
+    
+    // 符号表（INTERN 规则）：同名标识符只保存一份
+    vector<string> symbols;
+    vector<unsigned> symbolHashes;
+    vector<unsigned> symbolSlots;
+    unsigned intern(const char* p, size_t length);
+    
+    bool scanToken(Token& token);
+    void advance(size_t length);
+    void fillToken(Token& token, const char* type, size_t length);
+    
+    int matchDFA0(size_t startPos);
+    int matchDFA1(size_t startPos);
+    int matchDFA2(size_t startPos);
+    int matchDFA3(size_t startPos);
+    int matchDFA4(size_t startPos);
+    int matchDFA5(size_t startPos);
+    int matchDFA6(size_t startPos);
+    int matchDFA7(size_t startPos);
+    int matchDFA8(size_t startPos);
+    int matchDFA9(size_t startPos);
+    int matchDFA10(size_t startPos);
+    int matchDFA11(size_t startPos);
+    int matchDFA12(size_t startPos);
+    int matchDFA13(size_t startPos);
+    int matchDFA14(size_t startPos);
+    int matchDFA15(size_t startPos);
+    int matchDFA16(size_t startPos);
+    int matchDFA17(size_t startPos);
+    int matchDFA18(size_t startPos);
+    int matchDFA19(size_t startPos);
+    int matchDFA20(size_t startPos);
+    int matchDFA21(size_t startPos);
+    int matchDFA22(size_t startPos);
+    int matchDFA23(size_t startPos);
+    int matchDFA24(size_t startPos);
+    int matchDFA25(size_t startPos);
+    int matchDFA26(size_t startPos);
+    int matchDFA27(size_t startPos);
+    int matchDFA28(size_t startPos);
+    int matchDFA29(size_t startPos);
+    int matchDFA30(size_t startPos);
+    int matchDFA31(size_t startPos);
+    int matchDFA32(size_t startPos);
+    int matchDFA33(size_t startPos);
+    int matchDFA34(size_t startPos);
+    int matchDFA35(size_t startPos);
+    int matchDFA36(size_t startPos);
+    int matchDFA37(size_t startPos);
+    int matchDFA38(size_t startPos);
+    int matchDFA39(size_t startPos);
+    int matchDFA40(size_t startPos);
+    int matchDFA41(size_t startPos);
+    int matchDFA42(size_t startPos);
+    
+public:
+    Lexer() : pos(0), line(1), column(1), mode(0) {}
+    Lexer(const string& input) : text(input), pos(0), line(1), column(1), mode(0) {}
+    
+    // 从头分析新的输入，保留已分配的缓冲区和符号表
+    void reset(const char* data, size_t length);
+    void reset(const string& input) { reset(input.data(), input.size()); }
+    
+    Token* nextToken();
+    vector<Token*> tokenize();
+    
+    // 把剩余的记号写入 tokens（替换原有内容），返回记号数；
+    // 已有元素原地改写，反复使用同一个容器时不再分配内存
+    size_t tokenizeInto(vector<Token>& tokens);
+    
+    // TokenSource：供语法分析器按需拉取记号
+    bool next(Token& token) override { return scanToken(token); }
+    
+    // 模式（起始条件），只有属于当前模式的规则参与匹配
+    enum Mode { MODE_INITIAL = 0, MODE_COMMENT = 1 };
+    int getMode() const { return mode; }
+    void pushMode(int m) {
+        modeStack.push_back(mode);
+        mode = m;
+    }
+    void popMode() {
+        mode = modeStack.empty() ? MODE_INITIAL : modeStack.back();
+        if (!modeStack.empty()) {
+            modeStack.pop_back();
+        }
+    }
+    
+    // 符号编号对应的名字，编号在同一个 Lexer 内唯一
+    const string& symbolName(unsigned id) const { return symbols[id]; }
+    size_t symbolCount() const { return symbols.size(); }
+};
@@ -1,19 +1,178 @@
 #include "CodeGenerator.h"
+#include "Counting.h"
 #include "DFAMinimizer.h"
+#include "Derivative.h"
 #include "FileParser.h"
+#include "Glushkov.h"
 #include "RegexParser.h"
+#include "RegexSimplifier.h"
 #include "SubsetConstruction.h"
 #include "Thompson.h"
+#include <chrono>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <memory>
 #include <vector>
 using namespace std;
 
-int main() {
+// 比较三条构造路径：Thompson构造、Glushkov构造（NFA -> 子集构造）和导数构造
+// （直接得到DFA），统计NFA状态数、导数构造得到的DFA状态数和构造耗时（正则
+// 解析之后到DFA最小化为止），并检查最小化后的DFA相同。使用交或补的规则只有
+// 导数构造支持
+static bool runBenchmark(const vector<LexerRule> &rules, bool simplifyAST) {
+    const int repeat = 200;
+    RegexParser regexParser;
+    RegexSimplifier simplifier;
+    SubsetConstruction subset;
+    DFAMinimizer minimizer;
+
+    vector<shared_ptr<ASTNode>> asts;
+    for (const auto &rule : rules) {
+        auto ast = regexParser.parse(rule.regex);
+        asts.push_back(simplifyAST ? simplifier.simplify(ast) : ast);
+    }
+
+    auto elapsed = [](chrono::steady_clock::time_point begin) {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() -
+                                               begin)
+            .count();
+    };
+
+    cout << "构造对比（每条规则重复 " << repeat
+         << " 次，耗时依次为 Thompson / Glushkov / 导数）：" << endl;
+    bool identical = true;
+    double thompsonTotal = 0, glushkovTotal = 0, derivativeTotal = 0;
+    size_t thompsonStates = 0, glushkovStates = 0, derivativeStates = 0;
+    for (size_t i = 0; i < rules.size(); i++) {
+        shared_ptr<DFA> derivativeDFA, minimizedDFA;
+        auto begin = chrono::steady_clock::now();
+        for (int k = 0; k < repeat; k++) {
+            DerivativeConstruction derivative;
+            derivativeDFA = derivative.build(asts[i]);
+            minimizedDFA = minimizer.minimize(derivativeDFA);
+        }
+        double derivativeMs = elapsed(begin);
+        derivativeTotal += derivativeMs;
+        derivativeStates += derivativeDFA->states.size();
+        FlatDFA expected = FlatDFA::fromDFA(minimizedDFA);
+
+        cout << "  " << rules[i].tokenType << ": ";
+        if (DerivativeConstruction::needsDerivatives(asts[i])) {
+            cout << "导数DFA状态数 " << derivativeDFA->states.size()
+                 << "，DFA状态数 " << expected.stateCount << "，耗时 - / - / "
+                 << derivativeMs << " ms" << endl;
+            continue;
+        }
+
+        shared_ptr<NFA> thompsonNFA, glushkovNFA;
+        shared_ptr<DFA> thompsonDFA, glushkovDFA;
+        begin = chrono::steady_clock::now();
+        for (int k = 0; k < repeat; k++) {
+            ThompsonConstruction thompson;
+            thompsonNFA = thompson.build(asts[i]);
+            thompsonDFA = minimizer.minimize(subset.convert(thompsonNFA));
+        }
+        double thompsonMs = elapsed(begin);
+        begin = chrono::steady_clock::now();
+        for (int k = 0; k < repeat; k++) {
+            GlushkovConstruction glushkov;
+            glushkovNFA = glushkov.build(asts[i]);
+            glushkovDFA = minimizer.minimize(subset.convert(glushkovNFA));
+        }
+        double glushkovMs = elapsed(begin);
+
+        thompsonTotal += thompsonMs;
+        glushkovTotal += glushkovMs;
+        size_t thompsonCount = thompsonNFA->getAllStates().size();
+        size_t glushkovCount = glushkovNFA->getAllStates().size();
+        thompsonStates += thompsonCount;
+        glushkovStates += glushkovCount;
+
+        FlatDFA a = FlatDFA::fromDFA(thompsonDFA);
+        FlatDFA b = FlatDFA::fromDFA(glushkovDFA);
+        bool same = a.transitions == b.transitions &&
+                    a.accepting == b.accepting &&
+                    a.transitions == expected.transitions &&
+                    a.accepting == expected.accepting;
+        identical = identical && same;
+
+        cout << "NFA状态数 " << thompsonCount << " -> " << glushkovCount
+             << "，导数DFA状态数 " << derivativeDFA->states.size()
+             << "，DFA状态数 " << a.stateCount << "，耗时 " << thompsonMs
+             << " / " << glushkovMs << " / " << derivativeMs << " ms"
+             << (same ? "" : "（DFA不一致！）") << endl;
+    }
+    cout << "合计：NFA状态数 " << thompsonStates << " -> " << glushkovStates
+         << "，导数DFA状态数 " << derivativeStates << "，耗时 "
+         << thompsonTotal << " / " << glushkovTotal << " / " << derivativeTotal
+         << " ms" << endl;
+    cout << (identical ? "各构造得到的DFA完全相同" : "各构造得到的DFA不一致")
+         << endl;
+    return identical;
+}
+
+int main(int argc, char *argv[]) {
     // 直接指定文件路径
     string rulesFile = "lexer_rules.txt";
     string outputFile = "generated_lexer.cpp";
+    string headerFile = "generated_lexer.h";
+    string profileFile; // 可选：状态访问剖析文件
+    TableFormat tableFormat = TableFormat::DENSE;
+    bool instrument = false; // 生成带剖析计数器的词法分析器
+    bool errorTokens = false; // 非法输入返回 ERROR 记号而不抛异常
+    bool simplifyAST = true; // Thompson构造前化简正则表达式AST
+    bool useGlushkov = false; // 用Glushkov构造代替Thompson构造
+    bool useDerivative = false; // 用导数构造直接得到DFA
+    bool useCounting = false; // 大次数的计数重复用计数自动机表示
+    bool benchmark = false;   // 只比较两种NFA构造，不生成代码
+    unsigned threads = 1;     // 子集构造的线程数，0 表示硬件线程数
+    size_t stride2Budget = 0; // 双字节步进表的体积上限，0 表示不使用
+
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (arg == "--profile" && i + 1 < argc) {
+            profileFile = argv[++i];
+        } else if (arg == "--instrument") {
+            instrument = true;
+        } else if (arg == "--error-tokens") {
+            errorTokens = true;
+        } else if (arg == "--no-simplify") {
+            simplifyAST = false;
+        } else if (arg == "--glushkov") {
+            useGlushkov = true;
+        } else if (arg == "--derivative") {
+            useDerivative = true;
+        } else if (arg == "--counting") {
+            useCounting = true;
+        } else if (arg == "--bench") {
+            benchmark = true;
+        } else if (arg == "--stride2") {
+            stride2Budget = 32 * 1024; // 默认不超过常见的L1数据缓存
+        } else if (arg == "--stride2-budget" && i + 1 < argc) {
+            stride2Budget = static_cast<size_t>(atol(argv[++i]));
+        } else if (arg == "--threads" && i + 1 < argc) {
+            threads = static_cast<unsigned>(atoi(argv[++i]));
+        } else if (arg == "--table" && i + 1 < argc) {
+            string format = argv[++i];
+            if (format == "dense") {
+                tableFormat = TableFormat::DENSE;
+            } else if (format == "comb") {
+                tableFormat = TableFormat::COMB;
+            } else {
+                cerr << "未知的表格式: " << format << endl;
+                return 1;
+            }
+        } else {
+            cerr << "用法: " << argv[0]
+                 << " [--profile <剖析文件>] [--instrument] [--error-tokens] "
+                    "[--table dense|comb] [--no-simplify] [--glushkov] "
+                    "[--derivative] [--counting] [--threads <线程数>] "
+                    "[--stride2] [--stride2-budget <字节数>] [--bench]"
+                 << endl;
+            return 1;
+        }
+    }
 
     try {
         // 1. 读取规则文件
@@ -22,11 +181,17 @@ int main() {
         vector<LexerRule> rules = fileParser.readLexerRules(rulesFile);
         cout << "读取到 " << rules.size() << " 条规则" << endl;
 
+        if (benchmark) {
+            return runBenchmark(rules, simplifyAST) ? 0 : 1;
+        }
+
         // 2. 为每个规则构建DFA
         cout << "构建DFA..." << endl;
         RegexParser regexParser;
+        RegexSimplifier simplifier;
         ThompsonConstruction thompson;
-        SubsetConstruction subset;
+        GlushkovConstruction glushkov;
+        SubsetConstruction subset(threads);
         DFAMinimizer minimizer;
 
         vector<shared_ptr<DFA>> dfas;
@@ -39,8 +204,53 @@ int main() {
             // 解析正则表达式
             auto ast = regexParser.parse(rule.regex);
 
-            // Thompson构造：AST -> NFA
-            auto nfa = thompson.build(ast);
+            if (!useDerivative && !useGlushkov) {
+                // 字面串的并（如关键字表）：字典树直接得到最小DFA，化简时
+                // 提取公共前缀会破坏这种形式，所以在化简之前判断
+                auto dfa = ThompsonConstruction::buildLiteralDFA(ast);
+                if (dfa) {
+                    dfas.push_back(dfa);
+                    cout << "    完成（字典树DFA状态数: "
+                         << dfa->states.size() << "）" << endl;
+                    continue;
+                }
+            }
+
+            // 化简AST
+            if (simplifyAST) {
+                ast = simplifier.simplify(ast);
+            }
+
+            if (useCounting) {
+                // 计数自动机：不满足条件的规则仍按普通构造展开重复
+                CountingConstruction counting;
+                auto dfa = counting.build(ast);
+                if (dfa) {
+                    dfas.push_back(dfa);
+                    cout << "    完成（计数自动机状态数: "
+                         << dfa->states.size()
+                         << "，计数状态数: " << dfa->counters.size() << "）"
+                         << endl;
+                    continue;
+                }
+            }
+
+            if (useDerivative ||
+                DerivativeConstruction::needsDerivatives(ast)) {
+                // 导数构造：AST -> DFA（交和补只有导数构造支持）
+                DerivativeConstruction derivative;
+                auto dfa = derivative.build(ast);
+                auto minimizedDFA = minimizer.minimize(dfa);
+                dfas.push_back(minimizedDFA);
+
+                cout << "    完成（导数DFA状态数: " << dfa->states.size()
+                     << "，DFA状态数: " << minimizedDFA->states.size() << "）"
+                     << endl;
+                continue;
+            }
+
+            // Thompson构造或Glushkov构造：AST -> NFA
+            auto nfa = useGlushkov ? glushkov.build(ast) : thompson.build(ast);
 
             // 子集构造：NFA -> DFA
             auto dfa = subset.convert(nfa);
@@ -50,28 +260,58 @@ int main() {
 
             dfas.push_back(minimizedDFA);
 
-            cout << "    完成（状态数: " << minimizedDFA->states.size() << "）"
+            cout << "    完成（NFA状态数: " << nfa->getAllStates().size()
+                 << "，DFA状态数: " << minimizedDFA->states.size() << "）"
                  << endl;
         }
 
         // 3. 生成词法分析器代码
         cout << "生成词法分析器代码..." << endl;
         CodeGenerator codeGenerator;
+        codeGenerator.setHeaderName(headerFile);
+        codeGenerator.setTableFormat(tableFormat);
+        codeGenerator.setInstrument(instrument);
+        codeGenerator.setErrorTokens(errorTokens);
+        codeGenerator.setStride2Budget(stride2Budget);
+        if (!profileFile.empty()) {
+            cout << "读取剖析文件: " << profileFile << endl;
+            codeGenerator.setProfile(fileParser.readLexerProfile(profileFile));
+        }
         string code = codeGenerator.generateLexerCode(rules, dfas);
+        cout << "转换表体积：稠密表 " << codeGenerator.getDenseTableBytes()
+             << " 字节，压缩表 " << codeGenerator.getCombTableBytes() << " 字节"
+             << endl;
+        for (const string &tokenType : codeGenerator.getMemoizedRules()) {
+            cout << "  规则 " << tokenType
+                 << " 的最长匹配回溯可能超线性，已启用线性时间匹配" << endl;
+        }
+        for (const string &tokenType : codeGenerator.getScanRules()) {
+            cout << "  规则 " << tokenType
+                 << " 为单个字节集合的重复，直接扫描不查转换表" << endl;
+        }
+        if (stride2Budget > 0) {
+            cout << "双字节步进规则数: "
+                 << codeGenerator.getStride2Rules().size() << "/"
+                 << rules.size() << endl;
+        }
 
-        // 4. 写入文件
-        cout << "写入文件: " << outputFile << endl;
+        // 4. 写入文件：头文件声明 Token 和 Lexer，实现文件包含转换表和匹配代码
+        cout << "写入文件: " << headerFile << ", " << outputFile << endl;
+        ofstream headerOut(headerFile);
         ofstream out(outputFile);
-        if (!out.is_open()) {
-            cerr << "错误：无法打开输出文件 " << outputFile << endl;
+        if (!headerOut.is_open() || !out.is_open()) {
+            cerr << "错误：无法打开输出文件 " << headerFile << " 或 "
+                 << outputFile << endl;
             return 1;
         }
 
+        headerOut << codeGenerator.getHeaderCode();
+        headerOut.close();
         out << code;
         out.close();
 
         cout << "词法分析器生成成功！" << endl;
-        cout << "输出文件: " << outputFile << endl;
+        cout << "输出文件: " << headerFile << ", " << outputFile << endl;
 
     } catch (const exception &e) {
         cerr << "错误: " << e.what() << endl;
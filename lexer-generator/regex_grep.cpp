@@ -0,0 +1,220 @@
+#include "Regex.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+// 在 POSIX 平台上用 mmap 映射输入文件，其他平台整体读入内存
+#if defined(__unix__) || defined(__APPLE__)
+#define GREP_MMAP_AVAILABLE 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define GREP_MMAP_AVAILABLE 0
+#endif
+
+using namespace std;
+
+// 只读的文件内容：mmap 映射成功时指向映射区，否则指向 buffer
+class InputFile {
+  public:
+    explicit InputFile(const string &path) : data(nullptr), size(0) {
+#if GREP_MMAP_AVAILABLE
+        mapped = nullptr;
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw runtime_error("无法打开文件: " + path);
+        }
+        struct stat info;
+        if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) &&
+            info.st_size > 0) {
+            void *memory = mmap(nullptr, static_cast<size_t>(info.st_size),
+                                PROT_READ, MAP_PRIVATE, fd, 0);
+            if (memory != MAP_FAILED) {
+                mapped = memory;
+                data = static_cast<const char *>(memory);
+                size = static_cast<size_t>(info.st_size);
+                madvise(memory, size, MADV_SEQUENTIAL);
+            }
+        }
+        close(fd);
+        if (mapped) {
+            return;
+        }
+#endif
+        ifstream file(path, ios::binary);
+        if (!file.is_open()) {
+            throw runtime_error("无法打开文件: " + path);
+        }
+        ostringstream content;
+        content << file.rdbuf();
+        buffer = content.str();
+        data = buffer.data();
+        size = buffer.size();
+    }
+
+    ~InputFile() {
+#if GREP_MMAP_AVAILABLE
+        if (mapped) {
+            munmap(mapped, size);
+        }
+#endif
+    }
+
+    const char *begin() const { return data; }
+    const char *end() const { return data + size; }
+
+  private:
+    const char *data;
+    size_t size;
+    string buffer;
+#if GREP_MMAP_AVAILABLE
+    void *mapped;
+#endif
+
+    InputFile(const InputFile &) = delete;
+    InputFile &operator=(const InputFile &) = delete;
+};
+
+struct GrepOptions {
+    bool lineNumbers = false; // -n：输出行号
+    bool countOnly = false;   // -c：只输出匹配的行数
+    bool showFileName = false; // 多个文件时在每行前加文件名
+};
+
+// 在一个文件中查找匹配的行，输出写入 out，返回匹配的行数
+static size_t grepFile(const Regex &regex, const string &path,
+                       const GrepOptions &options, string &out) {
+    InputFile file(path);
+    const char *begin = file.begin();
+    const char *end = file.end();
+    ostringstream oss;
+    size_t count = 0;
+    size_t lineNumber = 1;
+    const char *counted = begin; // lineNumber 为 counted 所在的行
+    const char *p = begin;
+    RegexMatch match;
+
+    // 整块按行搜索：没有匹配的大段输入只经过一次前缀筛选和DFA扫描，
+    // 找到匹配后再确定它所在的行。匹配不跨行，扫描到行尾为止
+    while (p < end && regex.searchLines(p, end, match)) {
+        const char *hit = p + match.position;
+        const char *lineBegin = hit;
+        while (lineBegin > p && lineBegin[-1] != '\n') {
+            lineBegin--;
+        }
+        const char *lineEnd = static_cast<const char *>(
+            memchr(hit, '\n', static_cast<size_t>(end - hit)));
+        if (!lineEnd) {
+            lineEnd = end;
+        }
+
+        count++;
+        if (!options.countOnly) {
+            lineNumber += static_cast<size_t>(count_if(
+                counted, lineBegin, [](char ch) { return ch == '\n'; }));
+            counted = lineBegin;
+            if (options.showFileName) {
+                oss << path << ":";
+            }
+            if (options.lineNumbers) {
+                oss << lineNumber << ":";
+            }
+            oss.write(lineBegin, lineEnd - lineBegin);
+            oss << "\n";
+        }
+        p = lineEnd + 1;
+    }
+
+    if (options.countOnly) {
+        if (options.showFileName) {
+            oss << path << ":";
+        }
+        oss << count << "\n";
+    }
+    out = oss.str();
+    return count;
+}
+
+int main(int argc, char *argv[]) {
+    GrepOptions options;
+    unsigned threads = 0; // 0 表示硬件线程数
+    int i = 1;
+    for (; i < argc && argv[i][0] == '-' && argv[i][1] != '\0'; i++) {
+        string arg = argv[i];
+        if (arg == "-n") {
+            options.lineNumbers = true;
+        } else if (arg == "-c") {
+            options.countOnly = true;
+        } else if (arg == "-j" && i + 1 < argc) {
+            threads = static_cast<unsigned>(atoi(argv[++i]));
+        } else {
+            break;
+        }
+    }
+    if (argc - i < 2) {
+        cerr << "用法: " << argv[0] << " [-n] [-c] [-j <线程数>] <正则表达式> "
+             << "<文件>..." << endl;
+        return 2;
+    }
+
+    unique_ptr<Regex> regex;
+    try {
+        regex.reset(new Regex(argv[i++]));
+    } catch (const exception &e) {
+        cerr << "正则表达式错误: " << e.what() << endl;
+        return 2;
+    }
+
+    vector<string> files(argv + i, argv + argc);
+    options.showFileName = files.size() > 1;
+    if (threads == 0) {
+        threads = max(thread::hardware_concurrency(), 1u);
+    }
+    threads = static_cast<unsigned>(min<size_t>(threads, files.size()));
+
+    // 每个线程依次领取下一个文件，输出先缓存，全部完成后按文件顺序打印
+    vector<string> outputs(files.size());
+    vector<string> errors(files.size());
+    vector<size_t> counts(files.size(), 0);
+    atomic<size_t> next(0);
+    auto worker = [&]() {
+        for (size_t k; (k = next++) < files.size();) {
+            try {
+                counts[k] = grepFile(*regex, files[k], options, outputs[k]);
+            } catch (const exception &e) {
+                errors[k] = e.what();
+            }
+        }
+    };
+    vector<thread> pool;
+    for (unsigned t = 1; t < threads; t++) {
+        pool.push_back(thread(worker));
+    }
+    worker();
+    for (auto &t : pool) {
+        t.join();
+    }
+
+    bool matched = false;
+    bool failed = false;
+    for (size_t k = 0; k < files.size(); k++) {
+        if (!errors[k].empty()) {
+            cerr << errors[k] << endl;
+            failed = true;
+            continue;
+        }
+        cout << outputs[k];
+        matched = matched || counts[k] > 0;
+    }
+    // 与 grep 相同：有匹配返回0，没有匹配返回1，出错返回2
+    return failed ? 2 : (matched ? 0 : 1);
+}
@@ -1,9 +1,240 @@
-#include "generated_lexer.cpp"
+#include "CodeGenerator.h"
+#include "Counting.h"
+#include "DFAMinimizer.h"
+#include "Regex.h"
+#include "RegexParser.h"
+#include "RegexSet.h"
+#include "RegexSimplifier.h"
+#include "SimdDFA.h"
+#include "SubsetConstruction.h"
+#include "Thompson.h"
+#include "generated_lexer.h"
+#include <cstring>
 #include <iostream>
 #include <vector>
 
 using namespace std;
 
+// 很长的块注释被 COMMENT 模式的规则切成大量片段，逐段跳过时不能消耗栈空间
+static bool testLongComment() {
+    string code = "x /*";
+    for (int i = 0; i < 100000; i++) {
+        code += "a*";
+    }
+    code += "*/ y";
+    Lexer lexer(code);
+    vector<Token> tokens;
+    lexer.tokenizeInto(tokens);
+    return tokens.size() == 2 && tokens[0].value == "x" &&
+           tokens[1].value == "y";
+}
+
+// 注释中的空白和换行由 COMMENT 模式的规则处理；输入在 COMMENT 模式中
+// 结束（块注释没有闭合）时报错，而不是把之后的代码当作注释静默丢弃
+static bool testUnclosedComment() {
+    Lexer closed("x /* a\n  b */ y");
+    vector<Token> tokens;
+    closed.tokenizeInto(tokens);
+    bool ok = tokens.size() == 2 && tokens[1].value == "y" &&
+              tokens[1].line == 2 && tokens[1].column == 8;
+    Lexer unclosed("x = 1; /* never closed\n y = 2;");
+    try {
+        unclosed.tokenizeInto(tokens);
+        return false;
+    } catch (const runtime_error &) {
+        return ok;
+    }
+}
+
+// FLOAT_NUMBER 使用失败记忆：长数字串中每个起点的失败结论被之后的记号
+// 重用；reset 换输入后旧结论不能影响新输入
+static bool testFailureMemo() {
+    string digits(200000, '1');
+    Lexer lexer(digits + " 1.5 12 34");
+    vector<Token> tokens;
+    lexer.tokenizeInto(tokens);
+    bool ok = tokens.size() == 4 && tokens[0].type == "NUMBER" &&
+              tokens[0].value == digits && tokens[1].type == "FLOAT_NUMBER";
+    string next = "12.34";
+    lexer.reset(next.data(), next.size());
+    lexer.tokenizeInto(tokens);
+    return ok && tokens.size() == 1 && tokens[0].type == "FLOAT_NUMBER";
+}
+
+// 计数自动机的状态带有计数上下界，不能当作单个字节集合的重复直接扫描
+static bool testCountingNotScanned() {
+    vector<LexerRule> rules(2);
+    rules[0].tokenType = "D";
+    rules[0].regex = "[0-9]{1,20}";
+    rules[1].tokenType = "E";
+    rules[1].regex = "e{17,}";
+    RegexParser regexParser;
+    RegexSimplifier simplifier;
+    vector<shared_ptr<DFA>> dfas;
+    for (auto &rule : rules) {
+        rule.ignore = false;
+        rule.decode = LiteralDecode::NONE;
+        rule.popMode = false;
+        CountingConstruction counting;
+        auto dfa = counting.build(simplifier.simplify(
+            regexParser.parse(rule.regex)));
+        if (!dfa || dfa->counters.empty()) {
+            return false;
+        }
+        dfas.push_back(dfa);
+    }
+    CodeGenerator codeGenerator;
+    codeGenerator.generateLexerCode(rules, dfas);
+    return codeGenerator.getScanRules().empty();
+}
+
+// . 和取反字符类恰好匹配一个字节，不匹配空串（'\0' 在NFA中表示epsilon）
+static bool testCharClassNotEmpty() {
+    Regex dot("a.b");
+    Regex negated("a[^x]b");
+    string text = "xx ab yy\nab\naXb\n";
+    RegexMatch match;
+    return !dot.fullMatch("ab") && dot.fullMatch("aXb") &&
+           !negated.fullMatch("ab") && negated.fullMatch("aXb") &&
+           !negated.fullMatch("axb") && !Regex(".").fullMatch("") &&
+           !Regex("[^a]*").fullMatch("\n") &&
+           dot.search(text, match) && match.position == 12 &&
+           match.length == 3;
+}
+
+// search 是否找到 [position, position + length) 处的匹配
+static bool searchAt(const Regex &regex, const string &text,
+                     size_t position, size_t length) {
+    RegexMatch match;
+    return regex.search(text, match) && match.position == position &&
+           match.length == length;
+}
+
+// 最左最长：起点最小的匹配中取最长的，最早结束的匹配不一定最靠左；
+// 长输入上只扫描常数遍，不逐个起点重试
+static bool testLeftmostLongest() {
+    RegexMatch match;
+    string run(100000, 'a');
+    return searchAt(Regex("a|ab|abc"), "xxabcd", 2, 3) &&
+           searchAt(Regex("bc|abcd"), "abcd", 0, 4) &&
+           searchAt(Regex("ab|bcde"), "abcde", 0, 2) &&
+           searchAt(Regex("b|aaab"), "xaaab", 1, 4) &&
+           searchAt(Regex("a[a-z]*Z|b"), run + "b", run.size(), 1) &&
+           searchAt(Regex("a[a-z]*Z|b"), run + "bZ", 0, run.size() + 2) &&
+           Regex("ab").search("abxab", match, 1) && match.position == 3 &&
+           !Regex("abc").search("ababab", match);
+}
+
+// 按行查找：匹配不跨行，结果是第一个有匹配的行中的最左最长匹配
+static bool testSearchLines() {
+    Regex regex("a(.|\\n)*z|q");
+    string text = "a\nz q\nxaz";
+    const char *begin = text.data();
+    const char *end = begin + text.size();
+    RegexMatch match;
+    bool spanning = regex.search(begin, end, match) && match.position == 0 &&
+                    match.length == text.size();
+    bool inLine = regex.searchLines(begin, end, match) &&
+                  match.position == 4 && match.length == 1;
+    string lines = "aa\nbab\nb";
+    Regex tail("a[a-z]*b");
+    bool second = tail.searchLines(lines.data(), lines.data() + lines.size(),
+                                   match) &&
+                  match.position == 4 && match.length == 2;
+    bool newline = !Regex("b\\nb").searchLines(
+        lines.data(), lines.data() + lines.size(), match);
+    return spanning && inLine && second && newline;
+}
+
+// RegexSet 与 Regex 共用编译流程，. 和取反字符类同样不能匹配空串
+static bool testRegexSetCharClass() {
+    RegexSet anywhere({"a.b", "a[^x]b", "ab", "."});
+    RegexSet whole({"a.b", "a[^x]b", "ab", "."}, SetAnchor::ANCHOR_BOTH);
+    return anywhere.match("xx ab yy") == vector<int>({2, 3}) &&
+           anywhere.match("aXb") == vector<int>({0, 1, 3}) &&
+           anywhere.match("axb") == vector<int>({0, 3}) &&
+           anywhere.match("").empty() &&
+           whole.match("ab") == vector<int>({2}) &&
+           whole.match("a") == vector<int>({3}) && whole.match("").empty();
+}
+
+// INT64 超出范围时取最大值，DOUBLE 与 strtod 相同，UNESCAPE 去掉引号并
+// 处理转义
+static bool testLiteralDecoding() {
+    Lexer lexer("12 99999999999999999999 2.5 \"a\\tb\\\\c\" \"\"");
+    vector<Token> tokens;
+    lexer.tokenizeInto(tokens);
+    return tokens.size() == 5 && tokens[0].intValue == 12 &&
+           tokens[1].intValue == 9223372036854775807LL &&
+           tokens[2].type == "FLOAT_NUMBER" && tokens[2].floatValue == 2.5 &&
+           tokens[3].stringValue == "a\tb\\c" &&
+           tokens[4].type == "STRING_LITERAL" && tokens[4].stringValue.empty();
+}
+
+// INTERN：相同的标识符得到相同的符号编号，关键字不进入符号表
+static bool testIntern() {
+    Lexer lexer("foo bar if foo");
+    vector<Token> tokens;
+    lexer.tokenizeInto(tokens);
+    return tokens.size() == 4 && tokens[0].symbol == tokens[3].symbol &&
+           tokens[0].symbol != tokens[1].symbol && tokens[2].type == "IF" &&
+           lexer.symbolName(tokens[1].symbol) == "bar" &&
+           lexer.symbolCount() == 2;
+}
+
+// SimdDFA 分段计算的映射拼接后与整段执行的结果相同，接受与否与 Regex 一致
+static bool testSimdChunks() {
+    Regex number("[0-9]+(\\.[0-9]+)?");
+    SimdDFA simd;
+    if (!simd.build(Regex::compile("[0-9]+(\\.[0-9]+)?"))) {
+        return false;
+    }
+    const char *inputs[] = {"", "7", "1234567890.0987654321", "12.", "1.2.3",
+                            "0000000000000000000000000000000000000000.5"};
+    for (const char *input : inputs) {
+        const unsigned char *begin =
+            reinterpret_cast<const unsigned char *>(input);
+        const unsigned char *end = begin + strlen(input);
+        vector<int> states = simd.chunkStates(begin, end, 4, 2);
+        StateMap whole = simd.run(begin, end);
+        int last = whole.to[0] == simd.deadState() ? -1 : whole.to[0];
+        if (states.size() != 5 || states.back() != last ||
+            simd.accepts(begin, end) != number.fullMatch(input)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 字面串的并由字典树直接得到的DFA与子集构造加最小化的结果相同
+static bool testLiteralUnionDFA() {
+    RegexParser regexParser;
+    RegexSimplifier simplifier;
+    DFAMinimizer minimizer;
+    const char *patterns[] = {"if|int|in|else|elif|i", "ab|cb|b|()|ab",
+                              "ing|ring|sing|string|in"};
+    for (const char *pattern : patterns) {
+        auto ast = regexParser.parse(pattern);
+        auto trie = ThompsonConstruction::buildLiteralDFA(ast);
+        ThompsonConstruction thompson;
+        SubsetConstruction subset;
+        auto dfa = minimizer.minimize(
+            subset.convert(thompson.build(simplifier.simplify(ast))));
+        if (!trie) {
+            return false;
+        }
+        FlatDFA direct = FlatDFA::fromDFA(trie);
+        FlatDFA expected = FlatDFA::fromDFA(dfa);
+        if (direct.stateCount != expected.stateCount ||
+            direct.transitions != expected.transitions ||
+            direct.accepting != expected.accepting) {
+            return false;
+        }
+    }
+    auto mixed = regexParser.parse("if|i[a-z]");
+    return !ThompsonConstruction::buildLiteralDFA(mixed);
+}
+
 int main() {
     // 测试代码
     string testCode = R"(int x = 123;
@@ -45,5 +276,28 @@ string name = "hello";)";
         return 1;
     }
 
-    return 0;
+    cout << "\n回归测试：" << endl;
+    bool passed = true;
+    struct {
+        const char *name;
+        bool (*run)();
+    } tests[] = {{"长块注释不耗尽栈", testLongComment},
+                 {"计数规则不走字节集合扫描", testCountingNotScanned},
+                 {". 和取反字符类不匹配空串", testCharClassNotEmpty},
+                 {"RegexSet 中的 . 和取反字符类", testRegexSetCharClass},
+                 {"最左最长匹配的位置", testLeftmostLongest},
+                 {"按行查找", testSearchLines},
+                 {"未闭合的块注释报错", testUnclosedComment},
+                 {"失败记忆在记号之间重用", testFailureMemo},
+                 {"字面串的并直接构造最小DFA", testLiteralUnionDFA},
+                 {"字面量解码", testLiteralDecoding},
+                 {"标识符的符号表", testIntern},
+                 {"SimdDFA 分段执行", testSimdChunks}};
+    for (const auto &test : tests) {
+        bool ok = test.run();
+        cout << (ok ? "  通过: " : "  失败: ") << test.name << endl;
+        passed = passed && ok;
+    }
+
+    return passed ? 0 : 1;
 }
@@ -33,22 +33,46 @@ string ParserASTCodeGenerator::generateParserAST(
     oss << "};\n";
     oss << "#endif\n\n";
 
+    // 记号来源：与生成的词法分析器共用 TokenSource 接口
+    oss << "#ifndef TOKEN_SOURCE_DEFINED\n";
+    oss << "#define TOKEN_SOURCE_DEFINED\n";
+    oss << "class TokenSource {\n";
+    oss << "public:\n";
+    oss << "    virtual ~TokenSource() {}\n";
+    oss << "    virtual bool next(Token& token) = 0;\n";
+    oss << "};\n";
+    oss << "#endif\n\n";
+    oss << "class TokenVectorSource : public TokenSource {\n";
+    oss << "    vector<Token*> tokens;\n";
+    oss << "    size_t pos = 0;\n";
+    oss << "public:\n";
+    oss << "    TokenVectorSource(const vector<Token*>& ts) : tokens(ts) {}\n";
+    oss << "    bool next(Token& token) override { if (pos >= tokens.size()) return false; token = *tokens[pos++]; return true; }\n";
+    oss << "};\n\n";
+
+    // 向前看记号放在大小为 LOOKAHEAD 的环形缓冲区中，按需从来源拉取
     oss << "class Parser {\n";
     oss << "private:\n";
-    oss << "    vector<Token*> tokens;\n";
-    oss << "    size_t currentPos;\n";
-    oss << "    string currentTokenType() { return currentPos >= tokens.size() ? \"$\" : tokens[currentPos]->type; }\n";
-    oss << "    string currentTokenValue() { return currentPos >= tokens.size() ? \"\" : tokens[currentPos]->value; }\n";
-    oss << "    void consume() { if (currentPos < tokens.size()) currentPos++; }\n";
+    oss << "    static const size_t LOOKAHEAD = 1; // LL(1)\n";
+    oss << "    TokenVectorSource vectorSource;\n";
+    oss << "    TokenSource* source;\n";
+    oss << "    vector<Token> window; // window[head] 为当前记号\n";
+    oss << "    size_t head = 0, count = 0;\n";
+    oss << "    void fill() { while (count < LOOKAHEAD && source->next(window[(head + count) % LOOKAHEAD])) count++; }\n";
+    oss << "    string currentTokenType() { return count == 0 ? \"$\" : window[head].type; }\n";
+    oss << "    string currentTokenValue() { return count == 0 ? \"\" : window[head].value; }\n";
+    oss << "    void consume() { if (count > 0) { head = (head + 1) % LOOKAHEAD; count--; fill(); } }\n";
     oss << "    [[noreturn]] void error(const string& msg) {\n";
-    oss << "        string tokenInfo = currentPos < tokens.size() ? tokens[currentPos]->toString() : \"EOF\";\n";
+    oss << "        string tokenInfo = count > 0 ? window[head].toString() : \"EOF\";\n";
     oss << "        throw runtime_error(\"Parse error: \" + msg + \" at \" + tokenInfo);\n";
     oss << "    }\n\n";
     for (const auto& nt : grammar.nonTerminals) {
         oss << "    ASTNode* parse" << toValidIdentifier(nt) << "();\n";
     }
     oss << "\npublic:\n";
-    oss << "    Parser(const vector<Token*>& ts) : tokens(ts), currentPos(0) {}\n";
+    oss << "    Parser(const vector<Token*>& ts) : vectorSource(ts), source(&vectorSource), window(LOOKAHEAD, Token(\"\", \"\", 0, 0)) { fill(); }\n";
+    oss << "    // 边分析边从 ts（如生成的 Lexer）拉取记号\n";
+    oss << "    Parser(TokenSource& ts) : vectorSource(vector<Token*>()), source(&ts), window(LOOKAHEAD, Token(\"\", \"\", 0, 0)) { fill(); }\n";
     string start = grammar.startSymbol.empty() ? *grammar.nonTerminals.begin() : grammar.startSymbol;
     oss << "    ASTNode* parse() {\n";
     oss << "        ASTNode* root = parse" << toValidIdentifier(start) << "();\n";
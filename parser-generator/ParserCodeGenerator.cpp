@@ -41,6 +41,7 @@ string ParserCodeGenerator::generateParserCode(
     oss << "};\n";
     oss << "#endif\n";
     oss << "\n";
+    oss << generateTokenSource();
 
     // 生成 Parser 类
     oss << generateParserClass(grammar, table);
@@ -48,35 +49,94 @@ string ParserCodeGenerator::generateParserCode(
     return oss.str();
 }
 
+string ParserCodeGenerator::generateTokenSource() {
+    ostringstream oss;
+
+    // 与生成的词法分析器中的定义相同，先包含词法分析器头文件时不再重复定义
+    oss << "#ifndef TOKEN_SOURCE_DEFINED\n";
+    oss << "#define TOKEN_SOURCE_DEFINED\n";
+    oss << "// 按需产生记号的来源：语法分析器每次拉取一个记号，不必先得到整个"
+           "记号序列\n";
+    oss << "class TokenSource {\n";
+    oss << "  public:\n";
+    oss << "    virtual ~TokenSource() {}\n";
+    oss << "    // 把下一个记号写入 token（原有内容被覆盖），没有记号时返回 "
+           "false\n";
+    oss << "    virtual bool next(Token& token) = 0;\n";
+    oss << "};\n";
+    oss << "#endif\n";
+    oss << "\n";
+
+    oss << "// 把已经得到的记号序列当作记号来源（按 vector 传入记号时使用）\n";
+    oss << "class TokenVectorSource : public TokenSource {\n";
+    oss << "  private:\n";
+    oss << "    vector<Token*> tokens;\n";
+    oss << "    size_t pos;\n";
+    oss << "    \n";
+    oss << "  public:\n";
+    oss << "    TokenVectorSource(const vector<Token*>& tokenList) : "
+           "tokens(tokenList), pos(0) {}\n";
+    oss << "    \n";
+    oss << "    bool next(Token& token) override {\n";
+    oss << "        if (pos >= tokens.size()) {\n";
+    oss << "            return false;\n";
+    oss << "        }\n";
+    oss << "        token = *tokens[pos++];\n";
+    oss << "        return true;\n";
+    oss << "    }\n";
+    oss << "};\n";
+    oss << "\n";
+
+    return oss.str();
+}
+
 string ParserCodeGenerator::generateParserClass(
     const Grammar &grammar,
     const map<string, map<string, ProductionRule>> &table) {
     ostringstream oss;
 
+    // 记号按需从来源拉取到大小为向前看记号数的环形缓冲区中，
+    // 内存占用与输入长度无关
     oss << "class Parser {\n";
     oss << "  private:\n";
-    oss << "    vector<Token*> tokens;\n";
-    oss << "    size_t currentPos;\n";
+    oss << "    static const size_t LOOKAHEAD = 1; // LL(1)：向前看 1 个记号\n";
+    oss << "    \n";
+    oss << "    TokenVectorSource vectorSource; // 由 vector 构造时的来源\n";
+    oss << "    TokenSource* source;\n";
+    oss << "    vector<Token> window; // 环形缓冲区，window[head] 为当前记号\n";
+    oss << "    size_t head;\n";
+    oss << "    size_t count;         // 缓冲区中的记号数，为 0 表示输入结束\n";
+    oss << "    \n";
+    oss << "    // 从来源补充记号，直到缓冲区满或来源结束\n";
+    oss << "    void fill() {\n";
+    oss << "        while (count < LOOKAHEAD &&\n";
+    oss << "               source->next(window[(head + count) % LOOKAHEAD])) "
+           "{\n";
+    oss << "            count++;\n";
+    oss << "        }\n";
+    oss << "    }\n";
     oss << "    \n";
     oss << "    // 获取当前 token 的类型（如果已结束则返回 \"$\"）\n";
     oss << "    string currentTokenType() {\n";
-    oss << "        if (currentPos >= tokens.size()) {\n";
+    oss << "        if (count == 0) {\n";
     oss << "            return \"$\";\n";
     oss << "        }\n";
-    oss << "        return tokens[currentPos]->type;\n";
+    oss << "        return window[head].type;\n";
     oss << "    }\n";
     oss << "    \n";
     oss << "    // 消耗当前 token（移动到下一个）\n";
     oss << "    void consume() {\n";
-    oss << "        if (currentPos < tokens.size()) {\n";
-    oss << "            currentPos++;\n";
+    oss << "        if (count > 0) {\n";
+    oss << "            head = (head + 1) % LOOKAHEAD;\n";
+    oss << "            count--;\n";
+    oss << "            fill();\n";
     oss << "        }\n";
     oss << "    }\n";
     oss << "    \n";
     oss << "    // 抛出语法错误\n";
     oss << "    void error(const string& msg) {\n";
-    oss << "        string tokenInfo = currentPos < tokens.size() ? \n";
-    oss << "            tokens[currentPos]->toString() : \"EOF\";\n";
+    oss << "        string tokenInfo = count > 0 ? \n";
+    oss << "            window[head].toString() : \"EOF\";\n";
     oss << "        throw runtime_error(\"Parse error: \" + msg + \" at \" + "
            "tokenInfo);\n";
     oss << "    }\n";
@@ -88,8 +148,20 @@ string ParserCodeGenerator::generateParserClass(
     }
     oss << "    \n";
     oss << "  public:\n";
-    oss << "    Parser(const vector<Token*>& tokenList) : tokens(tokenList), "
-           "currentPos(0) {}\n";
+    oss << "    Parser(const vector<Token*>& tokenList)\n";
+    oss << "        : vectorSource(tokenList), source(&vectorSource),\n";
+    oss << "          window(LOOKAHEAD, Token(\"\", \"\", 0, 0)), head(0), "
+           "count(0) {\n";
+    oss << "        fill();\n";
+    oss << "    }\n";
+    oss << "    \n";
+    oss << "    // 边分析边从 tokenSource（如生成的 Lexer）拉取记号\n";
+    oss << "    Parser(TokenSource& tokenSource)\n";
+    oss << "        : vectorSource(vector<Token*>()), source(&tokenSource),\n";
+    oss << "          window(LOOKAHEAD, Token(\"\", \"\", 0, 0)), head(0), "
+           "count(0) {\n";
+    oss << "        fill();\n";
+    oss << "    }\n";
     oss << "    \n";
     oss << "    // 开始解析\n";
     oss << "    void parse() {\n";
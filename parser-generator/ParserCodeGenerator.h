@@ -18,6 +18,9 @@ class ParserCodeGenerator {
     // 将非终结符名称转换为有效的 C++ 标识符（替换单引号为下划线）
     string toValidIdentifier(const string &name);
 
+    // 生成记号来源接口 TokenSource 和基于 vector 的实现
+    string generateTokenSource();
+
     // 生成 Parser 类定义
     string
     generateParserClass(const Grammar &grammar,
@@ -0,0 +1,143 @@
+#pragma once
+#include <atomic>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+// 流水线记号来源：包含本文件之前需要先包含定义了 Token 和 TokenSource 的
+// 头文件（如 generated_lexer.h）
+//
+// 后台线程从 producer（如生成的 Lexer）成批取出记号，写入无锁的单生产者
+// 单消费者环形队列；语法分析器在当前线程通过 next() 逐个读取。词法分析和
+// 语法分析在两个线程上同时进行，大文件的总耗时接近两者中较慢的一个，
+// 而不是两者之和
+//
+// - 队列满时生产者等待消费者取走批次（反压），内存占用不超过
+//   slotCount * batchSize 个记号
+// - 生产者抛出的异常（如词法错误）在其之前的记号都被读取后，由 next()
+//   在消费者线程重新抛出
+// - 消费者提前结束（如语法错误抛出异常）时，析构函数通知生产者停止并
+//   等待其退出；producer 必须比 TokenPipeline 活得更久
+class TokenPipeline : public TokenSource {
+  public:
+    TokenPipeline(TokenSource &source, size_t batchSize = 1024,
+                  size_t slotCount = 8)
+        : producer(source), slots(slotCount), written(0), read(0),
+          stopped(false), current(0), offset(0), holding(false),
+          finished(false) {
+        // 批大小为 0 时每批都为空却不是最后一批，消费者会一直等待；
+        // 没有槽位时环形队列无法取模
+        if (batchSize == 0 || slotCount == 0) {
+            throw invalid_argument("TokenPipeline: batchSize 和 slotCount "
+                                   "必须大于 0");
+        }
+        for (auto &slot : slots) {
+            slot.tokens.assign(batchSize, Token("", "", 0, 0));
+        }
+        worker = thread(&TokenPipeline::produce, this);
+    }
+
+    ~TokenPipeline() {
+        stopped.store(true, memory_order_relaxed);
+        worker.join();
+    }
+
+    TokenPipeline(const TokenPipeline &) = delete;
+    TokenPipeline &operator=(const TokenPipeline &) = delete;
+
+    bool next(Token &token) override {
+        for (;;) {
+            if (holding) {
+                Batch &batch = slots[current % slots.size()];
+                if (offset < batch.size) {
+                    // 交换而不是复制：批次中的记号换回调用方的旧记号，
+                    // 两边的字符串缓冲区都被重用
+                    swap(token, batch.tokens[offset++]);
+                    return true;
+                }
+                if (batch.last) {
+                    // 最后一批不归还，生产者此时已经退出
+                    holding = false;
+                    finished = true;
+                    if (batch.error) {
+                        rethrow_exception(batch.error);
+                    }
+                    return false;
+                }
+                holding = false;
+                read.store(++current, memory_order_release);
+            }
+            if (finished) {
+                return false;
+            }
+            while (written.load(memory_order_acquire) == current) {
+                this_thread::yield();
+            }
+            holding = true;
+            offset = 0;
+        }
+    }
+
+  private:
+    // 环形队列中的一个槽位，存放一批记号
+    struct Batch {
+        vector<Token> tokens;
+        size_t size = 0;     // 本批的有效记号数
+        bool last = false;   // 来源已结束（或出错），之后没有批次
+        exception_ptr error; // 生产者抛出的异常
+    };
+
+    // 生产者和消费者各自频繁写入的计数放在不同的缓存行，避免伪共享
+    static const size_t cacheLine = 64;
+
+    TokenSource &producer;
+    vector<Batch> slots;
+    atomic<size_t> written; // 已写入的批次数（生产者写）
+    char pad0[cacheLine];
+    atomic<size_t> read; // 已归还的批次数（消费者写）
+    char pad1[cacheLine];
+    atomic<bool> stopped; // 消费者已放弃，生产者应当退出
+
+    // 以下仅由消费者访问
+    size_t current; // 当前批次的序号
+    size_t offset;  // 当前批次中下一个记号的位置
+    bool holding;   // 是否持有当前批次
+    bool finished;
+
+    thread worker;
+
+    void produce() {
+        size_t count = 0;
+        for (;;) {
+            // 队列满时等待消费者归还槽位
+            while (count - read.load(memory_order_acquire) == slots.size()) {
+                if (stopped.load(memory_order_relaxed)) {
+                    return;
+                }
+                this_thread::yield();
+            }
+            if (stopped.load(memory_order_relaxed)) {
+                return;
+            }
+            Batch &batch = slots[count % slots.size()];
+            batch.size = 0;
+            try {
+                while (batch.size < batch.tokens.size() &&
+                       producer.next(batch.tokens[batch.size])) {
+                    batch.size++;
+                }
+            } catch (...) {
+                batch.error = current_exception();
+            }
+            batch.last = batch.error || batch.size < batch.tokens.size();
+            written.store(++count, memory_order_release);
+            if (batch.last) {
+                return;
+            }
+        }
+    }
+};
@@ -20,30 +20,74 @@ struct Token {
 };
 #endif
 
-class Parser {
+#ifndef TOKEN_SOURCE_DEFINED
+#define TOKEN_SOURCE_DEFINED
+// 按需产生记号的来源：语法分析器每次拉取一个记号，不必先得到整个记号序列
+class TokenSource {
+  public:
+    virtual ~TokenSource() {}
+    // 把下一个记号写入 token（原有内容被覆盖），没有记号时返回 false
+    virtual bool next(Token& token) = 0;
+};
+#endif
+
+// 把已经得到的记号序列当作记号来源（按 vector 传入记号时使用）
+class TokenVectorSource : public TokenSource {
   private:
     vector<Token*> tokens;
-    size_t currentPos;
+    size_t pos;
+    
+  public:
+    TokenVectorSource(const vector<Token*>& tokenList) : tokens(tokenList), pos(0) {}
+    
+    bool next(Token& token) override {
+        if (pos >= tokens.size()) {
+            return false;
+        }
+        token = *tokens[pos++];
+        return true;
+    }
+};
+
+class Parser {
+  private:
+    static const size_t LOOKAHEAD = 1; // LL(1)：向前看 1 个记号
+    
+    TokenVectorSource vectorSource; // 由 vector 构造时的来源
+    TokenSource* source;
+    vector<Token> window; // 环形缓冲区，window[head] 为当前记号
+    size_t head;
+    size_t count;         // 缓冲区中的记号数，为 0 表示输入结束
+    
+    // 从来源补充记号，直到缓冲区满或来源结束
+    void fill() {
+        while (count < LOOKAHEAD &&
+               source->next(window[(head + count) % LOOKAHEAD])) {
+            count++;
+        }
+    }
     
     // 获取当前 token 的类型（如果已结束则返回 "$"）
     string currentTokenType() {
-        if (currentPos >= tokens.size()) {
+        if (count == 0) {
             return "$";
         }
-        return tokens[currentPos]->type;
+        return window[head].type;
     }
     
     // 消耗当前 token（移动到下一个）
     void consume() {
-        if (currentPos < tokens.size()) {
-            currentPos++;
+        if (count > 0) {
+            head = (head + 1) % LOOKAHEAD;
+            count--;
+            fill();
         }
     }
     
     // 抛出语法错误
     void error(const string& msg) {
-        string tokenInfo = currentPos < tokens.size() ? 
-            tokens[currentPos]->toString() : "EOF";
+        string tokenInfo = count > 0 ? 
+            window[head].toString() : "EOF";
         throw runtime_error("Parse error: " + msg + " at " + tokenInfo);
     }
     
@@ -66,7 +110,18 @@ class Parser {
     void parseWhileStmt();
     
   public:
-    Parser(const vector<Token*>& tokenList) : tokens(tokenList), currentPos(0) {}
+    Parser(const vector<Token*>& tokenList)
+        : vectorSource(tokenList), source(&vectorSource),
+          window(LOOKAHEAD, Token("", "", 0, 0)), head(0), count(0) {
+        fill();
+    }
+    
+    // 边分析边从 tokenSource（如生成的 Lexer）拉取记号
+    Parser(TokenSource& tokenSource)
+        : vectorSource(vector<Token*>()), source(&tokenSource),
+          window(LOOKAHEAD, Token("", "", 0, 0)), head(0), count(0) {
+        fill();
+    }
     
     // 开始解析
     void parse() {
@@ -19,15 +19,36 @@ struct Token {
 };
 #endif
 
+#ifndef TOKEN_SOURCE_DEFINED
+#define TOKEN_SOURCE_DEFINED
+class TokenSource {
+public:
+    virtual ~TokenSource() {}
+    virtual bool next(Token& token) = 0;
+};
+#endif
+
+class TokenVectorSource : public TokenSource {
+    vector<Token*> tokens;
+    size_t pos = 0;
+public:
+    TokenVectorSource(const vector<Token*>& ts) : tokens(ts) {}
+    bool next(Token& token) override { if (pos >= tokens.size()) return false; token = *tokens[pos++]; return true; }
+};
+
 class Parser {
 private:
-    vector<Token*> tokens;
-    size_t currentPos;
-    string currentTokenType() { return currentPos >= tokens.size() ? "$" : tokens[currentPos]->type; }
-    string currentTokenValue() { return currentPos >= tokens.size() ? "" : tokens[currentPos]->value; }
-    void consume() { if (currentPos < tokens.size()) currentPos++; }
+    static const size_t LOOKAHEAD = 1; // LL(1)
+    TokenVectorSource vectorSource;
+    TokenSource* source;
+    vector<Token> window; // window[head] 为当前记号
+    size_t head = 0, count = 0;
+    void fill() { while (count < LOOKAHEAD && source->next(window[(head + count) % LOOKAHEAD])) count++; }
+    string currentTokenType() { return count == 0 ? "$" : window[head].type; }
+    string currentTokenValue() { return count == 0 ? "" : window[head].value; }
+    void consume() { if (count > 0) { head = (head + 1) % LOOKAHEAD; count--; fill(); } }
     [[noreturn]] void error(const string& msg) {
-        string tokenInfo = currentPos < tokens.size() ? tokens[currentPos]->toString() : "EOF";
+        string tokenInfo = count > 0 ? window[head].toString() : "EOF";
         throw runtime_error("Parse error: " + msg + " at " + tokenInfo);
     }
 
@@ -50,7 +71,9 @@ private:
     ASTNode* parseWhileStmt();
 
 public:
-    Parser(const vector<Token*>& ts) : tokens(ts), currentPos(0) {}
+    Parser(const vector<Token*>& ts) : vectorSource(ts), source(&vectorSource), window(LOOKAHEAD, Token("", "", 0, 0)) { fill(); }
+    // 边分析边从 ts（如生成的 Lexer）拉取记号
+    Parser(TokenSource& ts) : vectorSource(vector<Token*>()), source(&ts), window(LOOKAHEAD, Token("", "", 0, 0)) { fill(); }
     ASTNode* parse() {
         ASTNode* root = parseProgram();
         if (currentTokenType() != "$") error("Expected EOF");
@@ -1,6 +1,7 @@
-#include "../lexer-generator/generated_lexer.cpp"
+#include "../lexer-generator/generated_lexer.h"
 #define TOKEN_DEFINED
 #include "generated_parser.cpp"
+#include "TokenPipeline.h"
 #include <iostream>
 #include <vector>
 
@@ -63,5 +64,35 @@ if (result == 0) {
         delete token;
     }
 
-    return 0;
+    cout << "\n流水线测试：" << endl;
+    bool passed = true;
+
+    // 小批次、少槽位，让词法分析线程多次因队列满而等待
+    try {
+        Lexer lexer(testCode);
+        TokenPipeline pipeline(lexer, 2, 2);
+        Parser parser(pipeline);
+        parser.parse();
+        cout << "  通过: 两个线程流水解析" << endl;
+    } catch (const exception &e) {
+        cout << "  失败: 两个线程流水解析（" << e.what() << "）" << endl;
+        passed = false;
+    }
+
+    // 批大小或槽位数为 0 时构造函数拒绝，而不是死等或除以零
+    size_t sizes[][2] = {{0, 8}, {1024, 0}};
+    for (const auto &size : sizes) {
+        Lexer lexer(testCode);
+        bool rejected = false;
+        try {
+            TokenPipeline pipeline(lexer, size[0], size[1]);
+        } catch (const invalid_argument &) {
+            rejected = true;
+        }
+        cout << (rejected ? "  通过: " : "  失败: ") << "拒绝 batchSize="
+             << size[0] << ", slotCount=" << size[1] << endl;
+        passed = passed && rejected;
+    }
+
+    return passed ? 0 : 1;
 }
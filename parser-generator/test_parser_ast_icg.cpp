@@ -1,4 +1,4 @@
-#include "../lexer-generator/generated_lexer.cpp"
+#include "../lexer-generator/generated_lexer.h"
 #define TOKEN_DEFINED
 #include "generated_parser_ast.cpp"
 #include "IRGenerator.h"